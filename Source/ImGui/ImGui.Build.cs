@@ -66,13 +66,23 @@ public class ImGui : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"InputCore",
+				"Networking",
+				"RenderCore",
 				"Slate",
-				"SlateCore"
+				"SlateCore",
+				"Sockets",
+				"UMG"
 				// ... add private dependencies that you statically link with here ...
 			}
 			);
 
 
+#if UE_4_18_OR_LATER
+		// Used to read DPI of monitors on which ImGui widgets are displayed.
+		PrivateDependencyModuleNames.Add("ApplicationCore");
+#endif
+
+
 		if (bBuildEditor)
 		{
 			PrivateDependencyModuleNames.AddRange(
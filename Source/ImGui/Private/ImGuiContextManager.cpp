@@ -11,11 +11,6 @@
 
 #include <imgui.h>
 
-// MSVC warnings
-#ifdef _MSC_VER
-#pragma warning (disable: 4996) // 'This function or variable may be unsafe': strcpy, strdup, sprintf, vsnprintf, sscanf, fopen
-#endif
-
 // TODO: Refactor ImGui Context Manager, to handle different types of worlds.
 
 namespace
@@ -68,7 +63,9 @@ FImGuiContextManager::FImGuiContextManager(FImGuiModuleSettings& InSettings)
 	Settings.OnDPIScaleChangedDelegate.AddRaw(this, &FImGuiContextManager::SetDPIScale);
 
 	SetDPIScale(Settings.GetDPIScaleInfo());
-	BuildFontAtlas();
+
+	// Contexts can only start with a built atlas, so we build the first one immediately.
+	DefaultFontAtlas = FontAtlasCache.Request(DPIScale, true);
 
 	FWorldDelegates::OnWorldTickStart.AddRaw(this, &FImGuiContextManager::OnWorldTickStart);
 #if ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK
@@ -89,6 +86,9 @@ FImGuiContextManager::~FImGuiContextManager()
 
 void FImGuiContextManager::Tick(float DeltaSeconds)
 {
+	// Update atlases before contexts tick, so they can switch to atlases finished since the last tick.
+	FontAtlasCache.Tick();
+
 	// In editor, worlds can get invalid. We could remove corresponding entries, but that would mean resetting ImGui
 	// context every time when PIE session is restarted. Instead we freeze contexts until their worlds are re-created.
 
@@ -105,13 +105,6 @@ void FImGuiContextManager::Tick(float DeltaSeconds)
 			FImGuiDelegatesContainer::Get().OnWorldDebug(Pair.Key).Clear();
 		}
 	}
-
-	// Once all context tick they should use new fonts and we can release the old resources. Extra countdown is added
-	// wait for contexts that ticked outside of this function, before rebuilding fonts.
-	if (FontResourcesReleaseCountdown > 0 && !--FontResourcesReleaseCountdown)
-	{
-		FontResourcesToRelease.Empty();
-	}
 }
 
 #if ENGINE_COMPATIBILITY_LEGACY_WORLD_ACTOR_TICK
@@ -156,7 +149,7 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetEditorContextData()
 
 	if (UNLIKELY(!Data))
 	{
-		Data = &Contexts.Emplace(Utilities::EDITOR_CONTEXT_INDEX, FContextData{ GetEditorContextName(), Utilities::EDITOR_CONTEXT_INDEX, FontAtlas, DPIScale, -1 });
+		Data = &Contexts.Emplace(Utilities::EDITOR_CONTEXT_INDEX, FContextData{ GetEditorContextName(), Utilities::EDITOR_CONTEXT_INDEX, GetNewContextFontAtlas(), DPIScale, -1 });
 		OnContextProxyCreated.Broadcast(Utilities::EDITOR_CONTEXT_INDEX, *Data->ContextProxy);
 	}
 
@@ -171,7 +164,7 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetStandaloneWorldCont
 
 	if (UNLIKELY(!Data))
 	{
-		Data = &Contexts.Emplace(Utilities::STANDALONE_GAME_CONTEXT_INDEX, FContextData{ GetWorldContextName(), Utilities::STANDALONE_GAME_CONTEXT_INDEX, FontAtlas, DPIScale });
+		Data = &Contexts.Emplace(Utilities::STANDALONE_GAME_CONTEXT_INDEX, FContextData{ GetWorldContextName(), Utilities::STANDALONE_GAME_CONTEXT_INDEX, GetNewContextFontAtlas(), DPIScale });
 		OnContextProxyCreated.Broadcast(Utilities::STANDALONE_GAME_CONTEXT_INDEX, *Data->ContextProxy);
 	}
 
@@ -213,7 +206,7 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 #if WITH_EDITOR
 	if (UNLIKELY(!Data))
 	{
-		Data = &Contexts.Emplace(Index, FContextData{ GetWorldContextName(World), Index, FontAtlas, DPIScale, WorldContext->PIEInstance });
+		Data = &Contexts.Emplace(Index, FContextData{ GetWorldContextName(World), Index, GetNewContextFontAtlas(), DPIScale, WorldContext->PIEInstance });
 		OnContextProxyCreated.Broadcast(Index, *Data->ContextProxy);
 	}
 	else
@@ -224,7 +217,7 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 #else
 	if (UNLIKELY(!Data))
 	{
-		Data = &Contexts.Emplace(Index, FContextData{ GetWorldContextName(World), Index, FontAtlas, DPIScale });
+		Data = &Contexts.Emplace(Index, FContextData{ GetWorldContextName(World), Index, GetNewContextFontAtlas(), DPIScale });
 		OnContextProxyCreated.Broadcast(Index, *Data->ContextProxy);
 	}
 #endif
@@ -236,6 +229,16 @@ FImGuiContextManager::FContextData& FImGuiContextManager::GetWorldContextData(co
 	return *Data;
 }
 
+void FImGuiContextManager::SetContextDPIScaleFactor(int32 ContextIndex, float Factor)
+{
+	FContextData* Data = Contexts.Find(ContextIndex);
+	if (Data && Data->DPIScaleFactor != Factor)
+	{
+		Data->DPIScaleFactor = Factor;
+		UpdateDPIScale(*Data);
+	}
+}
+
 void FImGuiContextManager::SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo)
 {
 	const float Scale = ScaleInfo.GetImGuiScale();
@@ -243,65 +246,42 @@ void FImGuiContextManager::SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo)
 	{
 		DPIScale = Scale;
 
-		// Only rebuild font atlas if it is already built. Otherwise allow the other logic to pick a moment.
-		if (FontAtlas.IsBuilt())
+		// Only request a new atlas if the first one is already built. Otherwise allow the constructor to build it.
+		if (DefaultFontAtlas.IsValid())
 		{
-			RebuildFontAtlas();
+			DefaultFontAtlas = FontAtlasCache.Request(DPIScale);
 		}
 
 		for (auto& Pair : Contexts)
 		{
-			if (Pair.Value.ContextProxy)
-			{
-				Pair.Value.ContextProxy->SetDPIScale(DPIScale);
-			}
+			UpdateDPIScale(Pair.Value);
 		}
 	}
 }
 
-void FImGuiContextManager::BuildFontAtlas(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs)
+void FImGuiContextManager::UpdateDPIScale(FContextData& ContextData)
 {
-	if (!FontAtlas.IsBuilt())
+	if (ContextData.ContextProxy)
 	{
-		ImFontConfig FontConfig = {};
-		FontConfig.SizePixels = FMath::RoundFromZero(13.f * DPIScale);
-		FontAtlas.AddFontDefault(&FontConfig);
-
-		// Build custom fonts
-		for (const TPair<FName, TSharedPtr<ImFontConfig>>& CustomFontPair : CustomFontConfigs)
-		{
-			FName CustomFontName = CustomFontPair.Key;
-			TSharedPtr<ImFontConfig> CustomFontConfig = CustomFontPair.Value;
-
-			// Set font name for debugging
-			if (CustomFontConfig.IsValid())
-			{
-				strncpy(CustomFontConfig->Name, TCHAR_TO_ANSI(*CustomFontName.ToString()), 40);
-			}
-
-			FontAtlas.AddFont(CustomFontConfig.Get());
-		}
-
-		unsigned char* Pixels;
-		int Width, Height, Bpp;
-		FontAtlas.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
-
-		OnFontAtlasBuilt.Broadcast();
+		const float Scale = DPIScale * ContextData.DPIScaleFactor;
+		ContextData.ContextProxy->SetDPIScale(Scale, FontAtlasCache.Request(Scale));
 	}
 }
 
+TSharedRef<FImGuiFontAtlas> FImGuiContextManager::GetNewContextFontAtlas()
+{
+	// Default atlas is usually ready. If it is still building after a change of settings, we wait for it rather than
+	// starting a context with fonts for a different scale.
+	return FontAtlasCache.Request(DPIScale, true);
+}
+
 void FImGuiContextManager::RebuildFontAtlas()
 {
-	if (FontAtlas.IsBuilt())
-	{
-		// Keep the old resources alive for a few frames to give all contexts a chance to bind to new ones.
-		FontResourcesToRelease.Add(TUniquePtr<ImFontAtlas>(new ImFontAtlas()));
-		Swap(*FontResourcesToRelease.Last(), FontAtlas);
+	FontAtlasCache.SetCustomFonts(FImGuiModule::Get().GetProperties().GetCustomFonts());
+	DefaultFontAtlas = FontAtlasCache.Request(DPIScale);
 
-		// Typically, one frame should be enough but since we allow for custom ticking, we need at least to frames to
-		// wait for contexts that already ticked and will not do that before the end of the next tick of this manager.
-		FontResourcesReleaseCountdown = 3;
+	for (auto& Pair : Contexts)
+	{
+		UpdateDPIScale(Pair.Value);
 	}
-
-	BuildFontAtlas(FImGuiModule::Get().GetProperties().GetCustomFonts());
 }
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "ImGuiContextProxy.h"
+#include "ImGuiFontAtlasCache.h"
 #include "VersionCompatibility.h"
 
 
@@ -32,8 +33,8 @@ public:
 
 	~FImGuiContextManager();
 
-	ImFontAtlas& GetFontAtlas() { return FontAtlas; }
-	const ImFontAtlas& GetFontAtlas() const { return FontAtlas; }
+	// Get the cache with font atlases used by contexts.
+	FImGuiFontAtlasCache& GetFontAtlasCache() { return FontAtlasCache; }
 
 #if WITH_EDITOR
 	// Get or create editor ImGui context proxy.
@@ -61,20 +62,25 @@ public:
 	// Delegate called when a new context proxy is created.
 	FContextProxyCreatedDelegate OnContextProxyCreated;
 
-	// Delegate called after font atlas is built.
-	FSimpleMulticastDelegate OnFontAtlasBuilt;
+	// Set a factor by which the DPI scale of a context differs from the scale in settings, like when the context is
+	// displayed on a monitor with a different DPI. Contexts with the same resulting scale share fonts.
+	// @param ContextIndex - Index of the context
+	// @param Factor - Factor applied to the DPI scale from settings
+	void SetContextDPIScaleFactor(int32 ContextIndex, float Factor);
 
 	void Tick(float DeltaSeconds);
 
+	// Build new font atlases with the current custom fonts. Contexts keep using the old fonts until the new ones are
+	// ready.
 	void RebuildFontAtlas();
 
 private:
 
 	struct FContextData
 	{
-		FContextData(const FString& ContextName, int32 ContextIndex, ImFontAtlas& FontAtlas, float DPIScale, int32 InPIEInstance = -1)
+		FContextData(const FString& ContextName, int32 ContextIndex, const TSharedRef<FImGuiFontAtlas>& FontAtlas, float DPIScale, int32 InPIEInstance = -1)
 			: PIEInstance(InPIEInstance)
-			, ContextProxy(new FImGuiContextProxy(ContextName, ContextIndex, &FontAtlas, DPIScale))
+			, ContextProxy(new FImGuiContextProxy(ContextName, ContextIndex, FontAtlas, DPIScale))
 		{
 		}
 
@@ -82,6 +88,9 @@ private:
 
 		int32 PIEInstance = -1;
 		TUniquePtr<FImGuiContextProxy> ContextProxy;
+
+		// Factor applied to the DPI scale from settings.
+		float DPIScaleFactor = 1.f;
 	};
 
 #if ENGINE_COMPATIBILITY_LEGACY_WORLD_ACTOR_TICK
@@ -104,15 +113,20 @@ private:
 	FContextData& GetWorldContextData(const UWorld& World, int32* OutContextIndex = nullptr);
 
 	void SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo);
-	void BuildFontAtlas(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFontConfigs = {});
+	void UpdateDPIScale(FContextData& ContextData);
 
-	TMap<int32, FContextData> Contexts;
+	// Get a ready font atlas for a new context.
+	TSharedRef<FImGuiFontAtlas> GetNewContextFontAtlas();
+
+	// Cache is declared before contexts, so it outlives atlas references kept by them.
+	FImGuiFontAtlasCache FontAtlasCache;
 
-	ImFontAtlas FontAtlas;
-	TArray<TUniquePtr<ImFontAtlas>> FontResourcesToRelease;
+	// Atlas for the DPI scale from settings, kept even if no context uses it, so new contexts can start with it.
+	TSharedPtr<FImGuiFontAtlas> DefaultFontAtlas;
+
+	TMap<int32, FContextData> Contexts;
 
 	FImGuiModuleSettings& Settings;
 
 	float DPIScale = -1.f;
-	int32 FontResourcesReleaseCountdown = 0;
 };
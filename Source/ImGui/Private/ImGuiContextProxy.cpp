@@ -8,9 +8,12 @@
 #include "Utilities/Arrays.h"
 #include "VersionCompatibility.h"
 
+#include <imgui_internal.h>
+
 // Include ImPlot here so we can call `ImPlot::CreateContext`
 #include <implot.h>
 
+#include <Async/ParallelFor.h>
 #include <GenericPlatform/GenericPlatformFile.h>
 #include <Misc/Paths.h>
 
@@ -43,49 +46,26 @@ namespace
 		return FPaths::Combine(SaveDirectory, Name + TEXT(".ini"));
 	}
 
-	struct FGuardCurrentContext
+	// Lets ImGui sort large tables and ImPlot generate vertices of large items in chunks processed by task graph workers.
+	void ParallelForChunks(int Count, void (*Function)(int Index, void* FunctionData), void* FunctionData, void* UserData)
 	{
-		FGuardCurrentContext()
-			: OldContext(ImGui::GetCurrentContext())
-		{
-		}
-
-		~FGuardCurrentContext()
-		{
-			if (bRestore)
-			{
-				ImGui::SetCurrentContext(OldContext);
-			}
-		}
-
-		FGuardCurrentContext(FGuardCurrentContext&& Other)
-			: OldContext(MoveTemp(Other.OldContext))
-		{
-			Other.bRestore = false;
-		}
-
-		FGuardCurrentContext& operator=(FGuardCurrentContext&&) = delete;
-
-		FGuardCurrentContext(const FGuardCurrentContext&) = delete;
-		FGuardCurrentContext& operator=(const FGuardCurrentContext&) = delete;
-
-	private:
-
-		ImGuiContext* OldContext = nullptr;
-		bool bRestore = true;
-	};
+		ParallelFor(Count, [Function, FunctionData](int32 Index) { Function(Index, FunctionData); });
+	}
 }
 
-FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextIndex, ImFontAtlas* InFontAtlas, float InDPIScale)
-	: Name(InName)
+FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextIndex, const TSharedRef<FImGuiFontAtlas>& InFontAtlas, float InDPIScale)
+	: FontAtlas(InFontAtlas)
+	, Name(InName)
 	, ContextIndex(InContextIndex)
 	, IniFilename(TCHAR_TO_ANSI(*GetIniFile(InName)))
 {
 	// Create context.
-	Context = ImGui::CreateContext(InFontAtlas);
+	checkf(InFontAtlas->IsReady(), TEXT("Context '%s' needs a font atlas that is ready."), *InName);
+	Context = ImGui::CreateContext(&InFontAtlas->GetAtlas());
 
 	// Create ImPlot context
 	ImPlot::CreateContext();
+	ImPlot::SetParallelForCallback(&ParallelForChunks);
 
 	// Set this context in ImGui for initialization (any allocations will be tracked in this context).
 	SetAsCurrent();
@@ -96,12 +76,15 @@ FImGuiContextProxy::FImGuiContextProxy(const FString& InName, int32 InContextInd
 	// Set session data storage.
 	IO.IniFilename = IniFilename.c_str();
 
+	// Let ImGui run parallel work (like sorting large tables) on task graph workers.
+	IO.ParallelForFn = &ParallelForChunks;
+
 	// Start with the default canvas size.
 	ResetDisplaySize();
 	IO.DisplaySize = {(float)DisplaySize.X, (float)DisplaySize.Y};
 
-	// Set the initial DPI scale.
-	SetDPIScale(InDPIScale);
+	// Set the initial DPI scale (applied when the frame begins).
+	SetDPIScale(InDPIScale, InFontAtlas);
 
 	// Initialize key mapping, so context can correctly interpret input state.
 	ImGuiInterops::SetUnrealKeyMap(IO);
@@ -132,18 +115,31 @@ void FImGuiContextProxy::ResetDisplaySize()
 	DisplaySize = { DEFAULT_CANVAS_WIDTH, DEFAULT_CANVAS_HEIGHT };
 }
 
-void FImGuiContextProxy::SetDPIScale(float Scale)
+void FImGuiContextProxy::SetDPIScale(float Scale, const TSharedRef<FImGuiFontAtlas>& InFontAtlas)
 {
-	if (DPIScale != Scale)
+	PendingDPIScale = Scale;
+	PendingFontAtlas = InFontAtlas;
+}
+
+void FImGuiContextProxy::ApplyPendingDPIScale()
+{
+	// Switch only to a ready atlas, so the context never waits for fonts to build. Draw data from the last frame may
+	// still use the old atlas texture, but the cache keeps unused atlases for a few frames.
+	if (PendingFontAtlas.IsValid() && PendingFontAtlas->IsReady())
 	{
-		DPIScale = Scale;
+		FontAtlas = PendingFontAtlas.ToSharedRef();
+		PendingFontAtlas.Reset();
 
-		ImGuiStyle NewStyle = ImGuiStyle();
-		NewStyle.ScaleAllSizes(Scale);
+		ImGui::GetIO().Fonts = &FontAtlas->GetAtlas();
 
-		FGuardCurrentContext GuardContext;
-		SetAsCurrent();
-		ImGui::GetStyle() = MoveTemp(NewStyle);
+		if (DPIScale != PendingDPIScale)
+		{
+			DPIScale = PendingDPIScale;
+
+			ImGuiStyle NewStyle = ImGuiStyle();
+			NewStyle.ScaleAllSizes(DPIScale);
+			ImGui::GetStyle() = MoveTemp(NewStyle);
+		}
 	}
 }
 
@@ -175,6 +171,9 @@ void FImGuiContextProxy::DrawDebug()
 		// Delegates called in order specified in FImGuiDelegates.
 		BroadcastWorldDebug();
 		BroadcastMultiContextDebug();
+
+		// Profiler shows the cost of all delegates called in this frame, so it needs to be drawn after them.
+		DelegatesProfiler.DrawWindow(Name, LastFrameHeapAllocCount);
 	}
 }
 
@@ -192,6 +191,9 @@ void FImGuiContextProxy::Tick(float DeltaSeconds)
 			// Make sure that draw events are called before the end of the frame.
 			DrawDebug();
 
+			// Draw world-space primitives submitted during this frame behind all the windows.
+			WorldOverlay.Draw(*ImGui::GetBackgroundDrawList());
+
 			// Ending frame will produce render output that we capture and store for later use. This also puts context to
 			// state in which it does not allow to draw controls, so we want to immediately start a new frame.
 			EndFrame();
@@ -222,8 +224,14 @@ void FImGuiContextProxy::BeginFrame(float DeltaTime)
 
 		IO.DisplaySize = { (float)DisplaySize.X, (float)DisplaySize.Y };
 
+		ApplyPendingDPIScale();
+
+		FrameStartAllocCount = Context->DebugAllocInfo.TotalAllocCount;
+
 		ImGui::NewFrame();
 
+		DelegatesProfiler.BeginFrame();
+
 		bIsFrameStarted = true;
 		bIsDrawEarlyDebugCalled = false;
 		bIsDrawDebugCalled = false;
@@ -237,6 +245,8 @@ void FImGuiContextProxy::EndFrame()
 		// Prepare draw data (after this call we cannot draw to this context until we start a new frame).
 		ImGui::Render();
 
+		LastFrameHeapAllocCount = Context->DebugAllocInfo.TotalAllocCount - FrameStartAllocCount;
+
 		// Update our draw data, so we can use them later during Slate rendering while ImGui is in the middle of the
 		// next frame.
 		UpdateDrawData(ImGui::GetDrawData());
@@ -261,6 +271,9 @@ void FImGuiContextProxy::UpdateDrawData(ImDrawData* DrawData)
 		// If we are not rendering then this might be a good moment to empty the array.
 		DrawLists.Empty();
 	}
+
+	// Keep output of profiled delegates, so it can be reused in frames in which they are skipped.
+	DelegatesProfiler.UpdateDrawData(DrawData, DrawLists);
 }
 
 void FImGuiContextProxy::BroadcastWorldEarlyDebug()
@@ -270,7 +283,7 @@ void FImGuiContextProxy::BroadcastWorldEarlyDebug()
 		FSimpleMulticastDelegate& WorldEarlyDebugEvent = FImGuiDelegatesContainer::Get().OnWorldEarlyDebug(ContextIndex);
 		if (WorldEarlyDebugEvent.IsBound())
 		{
-			WorldEarlyDebugEvent.Broadcast();
+			DelegatesProfiler.Broadcast(FImGuiDelegatesProfiler::EEvent::WorldEarlyDebug, WorldEarlyDebugEvent);
 		}
 	}
 }
@@ -280,7 +293,7 @@ void FImGuiContextProxy::BroadcastMultiContextEarlyDebug()
 	FSimpleMulticastDelegate& MultiContextEarlyDebugEvent = FImGuiDelegatesContainer::Get().OnMultiContextEarlyDebug();
 	if (MultiContextEarlyDebugEvent.IsBound())
 	{
-		MultiContextEarlyDebugEvent.Broadcast();
+		DelegatesProfiler.Broadcast(FImGuiDelegatesProfiler::EEvent::MultiContextEarlyDebug, MultiContextEarlyDebugEvent);
 	}
 }
 
@@ -288,7 +301,7 @@ void FImGuiContextProxy::BroadcastWorldDebug()
 {
 	if (DrawEvent.IsBound())
 	{
-		DrawEvent.Broadcast();
+		DelegatesProfiler.Broadcast(FImGuiDelegatesProfiler::EEvent::ModuleDraw, DrawEvent);
 	}
 
 	if (ContextIndex != Utilities::INVALID_CONTEXT_INDEX)
@@ -296,7 +309,7 @@ void FImGuiContextProxy::BroadcastWorldDebug()
 		FSimpleMulticastDelegate& WorldDebugEvent = FImGuiDelegatesContainer::Get().OnWorldDebug(ContextIndex);
 		if (WorldDebugEvent.IsBound())
 		{
-			WorldDebugEvent.Broadcast();
+			DelegatesProfiler.Broadcast(FImGuiDelegatesProfiler::EEvent::WorldDebug, WorldDebugEvent);
 		}
 	}
 }
@@ -306,6 +319,6 @@ void FImGuiContextProxy::BroadcastMultiContextDebug()
 	FSimpleMulticastDelegate& MultiContextDebugEvent = FImGuiDelegatesContainer::Get().OnMultiContextDebug();
 	if (MultiContextDebugEvent.IsBound())
 	{
-		MultiContextDebugEvent.Broadcast();
+		DelegatesProfiler.Broadcast(FImGuiDelegatesProfiler::EEvent::MultiContextDebug, MultiContextDebugEvent);
 	}
 }
@@ -2,8 +2,11 @@
 
 #pragma once
 
+#include "ImGuiDelegatesProfiler.h"
 #include "ImGuiDrawData.h"
+#include "ImGuiFontAtlasCache.h"
 #include "ImGuiInputState.h"
+#include "ImGuiWorldOverlayBatch.h"
 #include "Utilities/WorldContextIndex.h"
 
 #include <GenericPlatform/ICursor.h>
@@ -19,7 +22,7 @@ class FImGuiContextProxy
 {
 public:
 
-	FImGuiContextProxy(const FString& Name, int32 InContextIndex, ImFontAtlas* InFontAtlas, float InDPIScale);
+	FImGuiContextProxy(const FString& Name, int32 InContextIndex, const TSharedRef<FImGuiFontAtlas>& InFontAtlas, float InDPIScale);
 	~FImGuiContextProxy();
 
 	FImGuiContextProxy(const FImGuiContextProxy&) = delete;
@@ -53,11 +56,17 @@ public:
 	// Reset the desired context display size to default size.
 	void ResetDisplaySize();
 
-	// Get the DPI scale set for this context.
+	// Get the DPI scale used by this context.
 	float GetDPIScale() const { return DPIScale; }
 
-	// Set the DPI scale for this context.
-	void SetDPIScale(float Scale);
+	// Set the DPI scale for this context. The scale and font atlas are applied together at the beginning of the first
+	// frame after the atlas is ready, so the context keeps using the old fonts while the new ones are built.
+	// @param Scale - DPI scale
+	// @param InFontAtlas - Font atlas built for that scale
+	void SetDPIScale(float Scale, const TSharedRef<FImGuiFontAtlas>& InFontAtlas);
+
+	// Get the font atlas used by this context.
+	FImGuiFontAtlas& GetFontAtlas() const { return *FontAtlas; }
 
 	// Whether this context has an active item (read once per frame during context update).
 	bool HasActiveItem() const { return bHasActiveItem; }
@@ -68,6 +77,9 @@ public:
 	// Cursor type desired by this context (updated once per frame during context update).
 	EMouseCursor::Type GetMouseCursor() const { return MouseCursor;  }
 
+	// Get world overlay batch collecting world-space primitives that are drawn at the end of the frame.
+	FImGuiWorldOverlayBatch& GetWorldOverlay() { return WorldOverlay; }
+
 	// Internal draw event used to draw module's examples and debug widgets. Unlike the delegates container, it is not
 	// passed when the module is reloaded, so all objects that are unloaded with the module should register here.
 	FSimpleMulticastDelegate& OnDraw() { return DrawEvent; }
@@ -88,6 +100,8 @@ private:
 
 	void UpdateDrawData(ImDrawData* DrawData);
 
+	void ApplyPendingDPIScale();
+
 	void BroadcastWorldEarlyDebug();
 	void BroadcastMultiContextEarlyDebug();
 
@@ -99,6 +113,13 @@ private:
 	FVector2D DisplaySize = FVector2D::ZeroVector;
 	float DPIScale = 1.f;
 
+	// Font atlas used by the context. Its reference keeps the atlas in the cache.
+	TSharedRef<FImGuiFontAtlas> FontAtlas;
+
+	// DPI scale and font atlas that will be used once the atlas is ready.
+	TSharedPtr<FImGuiFontAtlas> PendingFontAtlas;
+	float PendingDPIScale = 1.f;
+
 	EMouseCursor::Type MouseCursor = EMouseCursor::None;
 	bool bHasActiveItem = false;
 	bool bWantsMouseCapture = false;
@@ -107,8 +128,17 @@ private:
 	bool bIsDrawEarlyDebugCalled = false;
 	bool bIsDrawDebugCalled = false;
 
+	// Number of ImGui heap allocations made between the start and the end of the last frame. Transient data should use
+	// the frame arena, so in steady state this should be zero.
+	int32 FrameStartAllocCount = 0;
+	int32 LastFrameHeapAllocCount = 0;
+
 	FImGuiInputState InputState;
 
+	FImGuiWorldOverlayBatch WorldOverlay;
+
+	FImGuiDelegatesProfiler DelegatesProfiler;
+
 	TArray<FImGuiDrawList> DrawLists;
 
 	FString Name;
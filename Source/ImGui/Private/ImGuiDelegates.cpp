@@ -2,6 +2,7 @@
 
 #include "ImGuiDelegates.h"
 #include "ImGuiDelegatesContainer.h"
+#include "ImGuiDelegatesProfiler.h"
 
 #include <Engine/World.h>
 
@@ -35,3 +36,11 @@ FSimpleMulticastDelegate& FImGuiDelegates::OnMultiContextDebug()
 {
 	return FImGuiDelegatesContainer::Get().OnMultiContextDebug();
 }
+
+FSimpleDelegate FImGuiDelegates::MakeProfiled(const FName& Name, FSimpleDelegate Delegate)
+{
+	return FSimpleDelegate::CreateLambda([Name, Delegate = MoveTemp(Delegate)]()
+	{
+		FImGuiDelegatesProfiler::ExecuteProfiled(Name, Delegate);
+	});
+}
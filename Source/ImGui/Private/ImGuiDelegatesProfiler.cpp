@@ -0,0 +1,483 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiDelegatesProfiler.h"
+
+#include <HAL/IConsoleManager.h>
+#include <HAL/PlatformTime.h>
+#include <Templates/UnrealTemplate.h>
+
+#include <imgui_internal.h>
+
+
+namespace CVars
+{
+	TAutoConsoleVariable<int> ShowProfiler(TEXT("ImGui.Profiler.Show"), 0,
+		TEXT("Show window with the cost of ImGui debug delegates in every context.\n")
+		TEXT("0: disabled (default)\n")
+		TEXT("1: enabled"),
+		ECVF_Default);
+
+	TAutoConsoleVariable<float> ProfilerFrameBudget(TEXT("ImGui.Profiler.FrameBudget"), 0.f,
+		TEXT("Per-context frame budget for ImGui debug delegates, in milliseconds. Delegates wrapped with\n")
+		TEXT("FImGuiDelegates::MakeProfiled that would exceed this budget are skipped and their last output is reused.\n")
+		TEXT("0: disabled (default)"),
+		ECVF_Default);
+
+	TAutoConsoleVariable<int> ProfilerMaxStaleFrames(TEXT("ImGui.Profiler.MaxStaleFrames"), 10,
+		TEXT("Maximal number of consecutive frames in which an over-budget delegate can be skipped. After that it is\n")
+		TEXT("executed regardless of the budget, so all delegates are updated at least at a reduced rate."),
+		ECVF_Default);
+}
+
+namespace
+{
+	// Profiler of the context that is currently broadcasting its events.
+	FImGuiDelegatesProfiler* ActiveProfiler = nullptr;
+
+	// Number of frames after which we forget about delegates that are no longer executed.
+	constexpr uint32 ForgetDelegatesAfterFrames = 600;
+
+	// Weight of the last sample in the moving average.
+	constexpr double AverageWeight = 0.1;
+
+	const char* GetEventName(int32 Event)
+	{
+		static const char* const Names[] =
+		{
+			"Multi-Context Early Debug",
+			"World Early Debug",
+			"Module",
+			"World Debug",
+			"Multi-Context Debug"
+		};
+		return Names[Event];
+	}
+
+	FORCEINLINE bool IsActiveInThisFrame(const ImGuiWindow& Window)
+	{
+		return Window.LastFrameActive == GImGui->FrameCount;
+	}
+
+	// Count vertices in draw lists that are active in the current frame.
+	int32 CountVertices()
+	{
+		int32 Count = ImGui::GetBackgroundDrawList()->VtxBuffer.Size + ImGui::GetForegroundDrawList()->VtxBuffer.Size;
+		for (const ImGuiWindow* Window : GImGui->Windows)
+		{
+			if (IsActiveInThisFrame(*Window))
+			{
+				Count += Window->DrawList->VtxBuffer.Size;
+			}
+		}
+		return Count;
+	}
+
+	int32 FindDrawList(const ImDrawData& DrawData, const ImDrawList* DrawList)
+	{
+		for (int32 Index = 0; Index < DrawData.CmdListsCount; Index++)
+		{
+			if (DrawData.CmdLists[Index] == DrawList)
+			{
+				return Index;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	// Whether window can be kept alive while its delegate is skipped. Child windows are replayed together with their
+	// root windows, while transient windows like popups and tooltips are not.
+	FORCEINLINE bool IsReplayable(const ImGuiWindow& Window)
+	{
+		return !(Window.Flags & (ImGuiWindowFlags_ChildWindow | ImGuiWindowFlags_Popup | ImGuiWindowFlags_Tooltip));
+	}
+
+	// Submit window without contents, so it keeps its place in z-order and still captures mouse input. Explicit content
+	// size preserves size of auto-resizing windows and scrolling ranges. Windows with a close button are never kept
+	// alive (see ShouldSkip), since their p_open is not known here.
+	void KeepWindowAlive(const ImGuiWindow& Window)
+	{
+		check(!Window.HasCloseButton);
+		ImGui::SetNextWindowPos(Window.Pos);
+		ImGui::SetNextWindowContentSize(Window.ContentSize);
+		ImGui::Begin(Window.Name, nullptr, Window.Flags);
+		ImGui::End();
+	}
+
+	FORCEINLINE double ToMilliseconds(double Seconds)
+	{
+		return Seconds * 1000.0;
+	}
+}
+
+void FImGuiDelegatesProfiler::FStats::Record(double InTime, int32 InVertices)
+{
+	AverageTime = (Time == 0.0 && AverageTime == 0.0) ? InTime : FMath::Lerp(AverageTime, InTime, AverageWeight);
+	Time = InTime;
+	Vertices = InVertices;
+}
+
+void FImGuiDelegatesProfiler::ExecuteProfiled(const FName& Name, const FSimpleDelegate& Delegate)
+{
+	if (ActiveProfiler)
+	{
+		ActiveProfiler->Execute(Name, Delegate);
+	}
+	else
+	{
+		Delegate.ExecuteIfBound();
+	}
+}
+
+void FImGuiDelegatesProfiler::BeginFrame()
+{
+	FrameNumber++;
+	CompletedEventsTime = 0.0;
+
+	for (FEventStats& Stats : Events)
+	{
+		Stats.Time = 0.0;
+		Stats.Vertices = 0;
+		Stats.ProfiledTime = 0.0;
+		Stats.ProfiledVertices = 0;
+	}
+
+	for (auto It = Delegates.CreateIterator(); It; ++It)
+	{
+		if (FrameNumber - It->Value.LastFrame > ForgetDelegatesAfterFrames)
+		{
+			It.RemoveCurrent();
+		}
+		else
+		{
+			It->Value.bExecuted = false;
+			It->Value.bSkipped = false;
+		}
+	}
+}
+
+void FImGuiDelegatesProfiler::Broadcast(EEvent Event, const FSimpleMulticastDelegate& Delegate)
+{
+	TGuardValue<FImGuiDelegatesProfiler*> ActiveProfilerGuard(ActiveProfiler, this);
+	TGuardValue<EEvent> CurrentEventGuard(CurrentEvent, Event);
+	Nested = {};
+
+	const int32 VerticesBefore = CountVertices();
+	CurrentEventStartTime = FPlatformTime::Seconds();
+
+	Delegate.Broadcast();
+
+	const double Time = FPlatformTime::Seconds() - CurrentEventStartTime;
+	Events[(int32)Event].Record(Time, CountVertices() - VerticesBefore);
+	CompletedEventsTime += Time;
+}
+
+void FImGuiDelegatesProfiler::Execute(const FName& Name, const FSimpleDelegate& Delegate)
+{
+	// Collect cost and windows of nested profiled delegates separately, so they can be excluded from this one.
+	FNestedStats OuterNested = MoveTemp(Nested);
+	Nested = {};
+
+	{
+		FDelegateStats& Stats = Delegates.FindOrAdd(Name);
+		Stats.Event = CurrentEvent;
+		Stats.LastFrame = FrameNumber;
+
+		if (ShouldSkip(Stats))
+		{
+			Nested = MoveTemp(OuterNested);
+			Nested.Delegates.Add(Name);
+			Skip(Stats);
+			return;
+		}
+	}
+
+	TArray<const ImGuiWindow*, TInlineAllocator<64>> WindowsActiveBefore;
+	for (const ImGuiWindow* Window : GImGui->Windows)
+	{
+		if (IsActiveInThisFrame(*Window))
+		{
+			WindowsActiveBefore.Add(Window);
+		}
+	}
+
+	const int32 VerticesBefore = CountVertices();
+	const double StartTime = FPlatformTime::Seconds();
+
+	Delegate.ExecuteIfBound();
+
+	const double Time = FPlatformTime::Seconds() - StartTime;
+	const int32 Vertices = CountVertices() - VerticesBefore;
+	const double SelfTime = FMath::Max(Time - Nested.Time, 0.0);
+	const int32 SelfVertices = Vertices - Nested.Vertices;
+
+	// Find stats again, in case delegate modified the map by executing other profiled delegates.
+	FDelegateStats& Stats = Delegates.FindChecked(Name);
+	Stats.Record(SelfTime, SelfVertices);
+	Stats.NestedDelegates = MoveTemp(Nested.Delegates);
+	Stats.bExecuted = true;
+	Stats.SkippedFrames = 0;
+
+	// Windows that became active during this call belong to this delegate, unless they belong to nested delegates.
+	Stats.Windows.Reset();
+	Stats.bHasClosableWindows = Nested.bHasClosableWindows;
+	for (const ImGuiWindow* Window : GImGui->Windows)
+	{
+		if (IsActiveInThisFrame(*Window) && !WindowsActiveBefore.Contains(Window) && !Nested.Windows.Contains(Window->ID))
+		{
+			Stats.Windows.Add(Window->ID);
+			Stats.bHasClosableWindows |= Window->HasCloseButton;
+		}
+	}
+
+	FEventStats& EventStats = Events[(int32)Stats.Event];
+	EventStats.ProfiledTime += SelfTime;
+	EventStats.ProfiledVertices += SelfVertices;
+
+	// For an outer delegate, the whole cost of this call is nested.
+	OuterNested.Time += Time;
+	OuterNested.Vertices += Vertices;
+	OuterNested.Windows.Append(Nested.Windows);
+	OuterNested.Windows.Append(Stats.Windows);
+	OuterNested.Delegates.Add(Name);
+	OuterNested.bHasClosableWindows |= Stats.bHasClosableWindows;
+	Nested = MoveTemp(OuterNested);
+}
+
+void FImGuiDelegatesProfiler::Skip(FDelegateStats& Stats)
+{
+	Stats.LastFrame = FrameNumber;
+	Stats.bSkipped = true;
+	Stats.SkippedFrames++;
+	Stats.TotalSkipped++;
+
+	// Windows that are already active in this frame are also submitted by other code, so we don't replace them.
+	Stats.KeptAliveWindows.Reset();
+	for (ImGuiID WindowId : Stats.Windows)
+	{
+		const ImGuiWindow* Window = ImGui::FindWindowByID(WindowId);
+		if (Window && IsReplayable(*Window) && !IsActiveInThisFrame(*Window))
+		{
+			KeepWindowAlive(*Window);
+			Stats.KeptAliveWindows.Add(WindowId);
+		}
+	}
+	Nested.Windows.Append(Stats.Windows);
+
+	for (const FName& NestedName : Stats.NestedDelegates)
+	{
+		FDelegateStats* NestedStats = Delegates.Find(NestedName);
+		if (NestedStats && !NestedStats->bExecuted && !NestedStats->bSkipped)
+		{
+			Skip(*NestedStats);
+		}
+	}
+}
+
+bool FImGuiDelegatesProfiler::ShouldSkip(const FDelegateStats& Stats) const
+{
+	const double Budget = CVars::ProfilerFrameBudget.GetValueOnGameThread() / 1000.0;
+
+	// Only skip delegates that have output which we can reuse and that were not stale for too long. Delegates with
+	// closable windows are not skipped, because kept alive windows would lose their p_open.
+	return Budget > 0.0 && Stats.bHasOutput && !Stats.bHasClosableWindows
+		&& Stats.SkippedFrames < CVars::ProfilerMaxStaleFrames.GetValueOnGameThread()
+		&& GetFrameTime() + Stats.AverageTime > Budget;
+}
+
+double FImGuiDelegatesProfiler::GetFrameTime() const
+{
+	return CurrentEvent != EEvent::Num
+		? CompletedEventsTime + (FPlatformTime::Seconds() - CurrentEventStartTime)
+		: CompletedEventsTime;
+}
+
+void FImGuiDelegatesProfiler::UpdateDrawData(const ImDrawData* DrawData, TArray<FImGuiDrawList>& DrawLists)
+{
+	// We only need to keep output when we can skip delegates.
+	const bool bKeepOutput = DrawData && CVars::ProfilerFrameBudget.GetValueOnGameThread() > 0.f;
+
+	// Windows of skipped delegates, which were kept alive without contents, and positions of their draw lists.
+	struct FReplay
+	{
+		int32 Index;
+		ImGuiID Window;
+		const FDelegateStats* Stats;
+	};
+	TArray<FReplay, TInlineAllocator<16>> Replays;
+
+	for (auto& Entry : Delegates)
+	{
+		FDelegateStats& Stats = Entry.Value;
+		if (Stats.bExecuted)
+		{
+			Stats.Output.Reset();
+			Stats.bHasOutput = bKeepOutput;
+
+			if (bKeepOutput)
+			{
+				// Keep draw lists in the draw order, so children of the same root window are replayed in their order.
+				TArray<TPair<int32, ImGuiID>, TInlineAllocator<16>> Sources;
+				for (ImGuiID WindowId : Stats.Windows)
+				{
+					const ImGuiWindow* Window = ImGui::FindWindowByID(WindowId);
+					const int32 Index = Window ? FindDrawList(*DrawData, Window->DrawList) : INDEX_NONE;
+					if (DrawLists.IsValidIndex(Index) && Stats.Windows.Contains(Window->RootWindow->ID)
+						&& IsReplayable(*Window->RootWindow))
+					{
+						Sources.Emplace(Index, Window->RootWindow->ID);
+					}
+				}
+				Sources.Sort([](const auto& A, const auto& B) { return A.Key < B.Key; });
+
+				for (const auto& Source : Sources)
+				{
+					Stats.Output.Add({ Source.Value, DrawLists[Source.Key] });
+				}
+			}
+		}
+		else if (Stats.bSkipped && DrawData)
+		{
+			for (ImGuiID WindowId : Stats.KeptAliveWindows)
+			{
+				const ImGuiWindow* Window = ImGui::FindWindowByID(WindowId);
+				const int32 Index = Window ? FindDrawList(*DrawData, Window->DrawList) : INDEX_NONE;
+				if (DrawLists.IsValidIndex(Index))
+				{
+					Replays.Add({ Index, WindowId, &Stats });
+				}
+			}
+		}
+	}
+
+	// Replace empty draw lists of kept alive windows with their last output and insert their children after them.
+	// Going from the back, so insertions don't shift positions of draw lists that are not yet replaced.
+	Replays.Sort([](const FReplay& A, const FReplay& B) { return A.Index > B.Index; });
+	for (const FReplay& Replay : Replays)
+	{
+		bool bReplaced = false;
+		int32 InsertIndex = Replay.Index + 1;
+		for (const FOutputDrawList& Output : Replay.Stats->Output)
+		{
+			if (Output.RootWindow != Replay.Window)
+			{
+				continue;
+			}
+
+			if (!bReplaced)
+			{
+				DrawLists[Replay.Index] = Output.DrawList;
+				bReplaced = true;
+			}
+			else
+			{
+				DrawLists.Insert(Output.DrawList, InsertIndex++);
+			}
+		}
+	}
+}
+
+void FImGuiDelegatesProfiler::DrawWindow(const FString& ContextName, int32 HeapAllocations)
+{
+	if (CVars::ShowProfiler.GetValueOnGameThread() <= 0)
+	{
+		return;
+	}
+
+	ImGui::SetNextWindowSize({ 600.f, 320.f }, ImGuiCond_FirstUseEver);
+	if (ImGui::Begin("ImGui Delegates Profiler"))
+	{
+		ImGui::Text("Context: %s", TCHAR_TO_UTF8(*ContextName));
+
+		float Budget = CVars::ProfilerFrameBudget.GetValueOnGameThread();
+		ImGui::SetNextItemWidth(120.f);
+		if (ImGui::DragFloat("Frame Budget (ms)", &Budget, 0.05f, 0.f, 100.f, "%.2f"))
+		{
+			CVars::ProfilerFrameBudget->Set(FMath::Max(Budget, 0.f));
+		}
+		ImGui::SameLine();
+		ImGui::TextDisabled("Total: %.3f ms", ToMilliseconds(CompletedEventsTime));
+
+		// Transient ImGui data should come from the frame arena, so outside of warm-up heap allocations indicate
+		// buffers that still grow every frame.
+		const ImGuiFrameArena& Arena = GImGui->FrameArena;
+		ImGui::Text("Heap allocations: %d", HeapAllocations);
+		ImGui::SameLine();
+		ImGui::TextDisabled("Frame arena: %d / %d KB (peak %d KB), %d blocks", (int32)(Arena.FrameUsedBytes / 1024),
+			(int32)(Arena.GetCapacity() / 1024), (int32)(Arena.PeakUsedBytes / 1024), Arena.Blocks.Size);
+
+		constexpr ImGuiTableFlags TableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV
+			| ImGuiTableFlags_Resizable | ImGuiTableFlags_ScrollY;
+		if (ImGui::BeginTable("Delegates", 6, TableFlags))
+		{
+			ImGui::TableSetupScrollFreeze(0, 1);
+			ImGui::TableSetupColumn("Delegate", ImGuiTableColumnFlags_WidthStretch);
+			ImGui::TableSetupColumn("Time (ms)");
+			ImGui::TableSetupColumn("Average (ms)");
+			ImGui::TableSetupColumn("Vertices");
+			ImGui::TableSetupColumn("Skipped");
+			ImGui::TableSetupColumn("State");
+			ImGui::TableHeadersRow();
+
+			auto StatsRow = [](const char* Name, bool bIndent, double Time, double AverageTime, int32 Vertices)
+			{
+				ImGui::TableNextRow();
+
+				ImGui::TableNextColumn();
+				if (bIndent)
+				{
+					ImGui::Indent();
+				}
+				ImGui::TextUnformatted(Name);
+				if (bIndent)
+				{
+					ImGui::Unindent();
+				}
+
+				ImGui::TableNextColumn();
+				ImGui::Text("%.3f", ToMilliseconds(Time));
+				ImGui::TableNextColumn();
+				if (AverageTime >= 0.0)
+				{
+					ImGui::Text("%.3f", ToMilliseconds(AverageTime));
+				}
+				ImGui::TableNextColumn();
+				ImGui::Text("%d", Vertices);
+			};
+
+			for (int32 Event = 0; Event < (int32)EEvent::Num; Event++)
+			{
+				const FEventStats& EventStats = Events[Event];
+				StatsRow(GetEventName(Event), false, EventStats.Time, EventStats.AverageTime, EventStats.Vertices);
+
+				for (const auto& Entry : Delegates)
+				{
+					const FDelegateStats& Stats = Entry.Value;
+					if ((int32)Stats.Event == Event)
+					{
+						StatsRow(TCHAR_TO_UTF8(*Entry.Key.ToString()), true, Stats.Time, Stats.AverageTime, Stats.Vertices);
+						ImGui::TableNextColumn();
+						ImGui::Text("%u", Stats.TotalSkipped);
+						ImGui::TableNextColumn();
+						if (Stats.bSkipped)
+						{
+							ImGui::TextColored({ 1.f, 0.7f, 0.f, 1.f }, "stale (%d)", Stats.SkippedFrames);
+						}
+						else if (!Stats.bExecuted)
+						{
+							ImGui::TextDisabled("idle");
+						}
+					}
+				}
+
+				if (EventStats.Time > 0.0)
+				{
+					StatsRow("(other)", true, FMath::Max(EventStats.Time - EventStats.ProfiledTime, 0.0), -1.0,
+						EventStats.Vertices - EventStats.ProfiledVertices);
+				}
+			}
+
+			ImGui::EndTable();
+		}
+	}
+	ImGui::End();
+}
@@ -0,0 +1,151 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDrawData.h"
+
+#include <Containers/Map.h>
+#include <Delegates/Delegate.h>
+#include <UObject/NameTypes.h>
+
+#include <imgui.h>
+
+
+// Records the cost of debug events broadcast by one ImGui context: CPU time and the number of vertices emitted,
+// measured as growth of draw lists that are active in the current frame. Delegates wrapped with
+// FImGuiDelegates::MakeProfiled are tracked individually. When a frame budget is set (ImGui.Profiler.FrameBudget),
+// profiled delegates that would exceed it are skipped for a limited number of frames, in which case their windows are
+// kept alive and their last output is replayed.
+class FImGuiDelegatesProfiler
+{
+public:
+
+	// Events broadcast by the context proxy, in the order of broadcasting.
+	enum class EEvent : uint8
+	{
+		MultiContextEarlyDebug,
+		WorldEarlyDebug,
+		ModuleDraw,
+		WorldDebug,
+		MultiContextDebug,
+
+		Num
+	};
+
+	FImGuiDelegatesProfiler() = default;
+
+	FImGuiDelegatesProfiler(const FImGuiDelegatesProfiler&) = delete;
+	FImGuiDelegatesProfiler& operator=(const FImGuiDelegatesProfiler&) = delete;
+
+	FImGuiDelegatesProfiler(FImGuiDelegatesProfiler&&) = delete;
+	FImGuiDelegatesProfiler& operator=(FImGuiDelegatesProfiler&&) = delete;
+
+	// Execute a delegate, profiling it in the context that is currently broadcasting its events. Outside of broadcasts
+	// delegate is executed without profiling.
+	// @param Name - Name identifying delegate in the profiler
+	// @param Delegate - Delegate to execute
+	static void ExecuteProfiled(const FName& Name, const FSimpleDelegate& Delegate);
+
+	// Reset frame statistics. Should be called when context starts a new frame.
+	void BeginFrame();
+
+	// Broadcast an event and record its cost.
+	// @param Event - Event that is broadcast
+	// @param Delegate - Multicast delegate of that event
+	void Broadcast(EEvent Event, const FSimpleMulticastDelegate& Delegate);
+
+	// Keep output of profiled delegates that were executed in this frame and replay the last output of delegates that
+	// were skipped, in place of their windows. Should be called after transferring draw data from the context.
+	// @param DrawData - ImGui draw data from which draw lists were transferred
+	// @param DrawLists - Draw lists transferred from the context
+	void UpdateDrawData(const ImDrawData* DrawData, TArray<FImGuiDrawList>& DrawLists);
+
+	// Draw the profiler window, if it is enabled (ImGui.Profiler.Show).
+	// @param ContextName - Name of the profiled context
+	// @param HeapAllocations - Number of ImGui heap allocations made by the context in the last frame
+	void DrawWindow(const FString& ContextName, int32 HeapAllocations);
+
+private:
+
+	struct FStats
+	{
+		// Cost in the last frame in which the delegate or event was executed.
+		double Time = 0.0;
+		int32 Vertices = 0;
+
+		// Moving average of the execution time.
+		double AverageTime = 0.0;
+
+		void Record(double InTime, int32 InVertices);
+	};
+
+	struct FOutputDrawList
+	{
+		// Root window to which this draw list belongs.
+		ImGuiID RootWindow = 0;
+		FImGuiDrawList DrawList;
+	};
+
+	struct FDelegateStats : FStats
+	{
+		// Output of the last execution in the draw order, reused in frames in which this delegate is skipped.
+		TArray<FOutputDrawList> Output;
+		TArray<ImGuiID> Windows;
+
+		// Windows kept alive in the current frame, in which last output is replayed.
+		TArray<ImGuiID> KeptAliveWindows;
+
+		// Profiled delegates executed from inside of this one, which are skipped together with it.
+		TArray<FName> NestedDelegates;
+
+		EEvent Event = EEvent::Num;
+
+		uint32 LastFrame = 0;
+		int32 SkippedFrames = 0;
+		uint32 TotalSkipped = 0;
+
+		bool bHasOutput = false;
+		// Whether this or nested delegates submit windows with a close button. ImGui doesn't keep their p_open, so they
+		// cannot be kept alive without losing it, and such delegates are never skipped.
+		bool bHasClosableWindows = false;
+		bool bExecuted = false;
+		bool bSkipped = false;
+	};
+
+	struct FEventStats : FStats
+	{
+		// Part of the cost taken by profiled delegates in the last frame.
+		double ProfiledTime = 0.0;
+		int32 ProfiledVertices = 0;
+	};
+
+	// Cost and windows of profiled delegates executed from inside of the currently executed delegate. They are
+	// attributed only to the inner delegates, so nothing is counted twice.
+	struct FNestedStats
+	{
+		double Time = 0.0;
+		int32 Vertices = 0;
+		TArray<ImGuiID> Windows;
+		TArray<FName> Delegates;
+		bool bHasClosableWindows = false;
+	};
+
+	void Execute(const FName& Name, const FSimpleDelegate& Delegate);
+
+	void Skip(FDelegateStats& Stats);
+
+	bool ShouldSkip(const FDelegateStats& Stats) const;
+
+	double GetFrameTime() const;
+
+	TMap<FName, FDelegateStats> Delegates;
+	FEventStats Events[(int32)EEvent::Num];
+
+	EEvent CurrentEvent = EEvent::Num;
+	double CurrentEventStartTime = 0.0;
+	double CompletedEventsTime = 0.0;
+
+	FNestedStats Nested;
+
+	uint32 FrameNumber = 0;
+};
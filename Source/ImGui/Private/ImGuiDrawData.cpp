@@ -2,20 +2,42 @@
 
 #include "ImGuiDrawData.h"
 
+#include <Hash/CityHash.h>
+
 
 #if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform, const FSlateRotatedRect& VertexClippingRect) const
+void FImGuiDrawList::CopyCommandData(int CommandNb, const FTransform2D& Transform, const FSlateRotatedRect& VertexClippingRect,
+	TArray<FSlateVertex>& OutVertexBuffer, TArray<SlateIndex>& OutIndexBuffer) const
 #else
-void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform) const
+void FImGuiDrawList::CopyCommandData(int CommandNb, const FTransform2D& Transform, TArray<FSlateVertex>& OutVertexBuffer,
+	TArray<SlateIndex>& OutIndexBuffer) const
 #endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 {
-	// Reset and reserve space in destination buffer.
-	OutVertexBuffer.SetNumUninitialized(ImGuiVertexBuffer.Size, false);
+	const ImDrawCmd& ImGuiCommand = ImGuiCommandBuffer[CommandNb];
+	const ImDrawIdx* Indices = ImGuiIndexBuffer.Data + ImGuiCommand.IdxOffset;
+
+	// Find vertices referenced by this command, so we only convert those (commands can share vertices, so we need to
+	// scan indices).
+	uint32 MinIndex = MAX_uint32;
+	uint32 MaxIndex = 0;
+	for (uint32 Idx = 0; Idx < ImGuiCommand.ElemCount; Idx++)
+	{
+		MinIndex = FMath::Min<uint32>(MinIndex, Indices[Idx]);
+		MaxIndex = FMath::Max<uint32>(MaxIndex, Indices[Idx]);
+	}
+
+	const int32 NumVertices = (MinIndex <= MaxIndex) ? MaxIndex - MinIndex + 1 : 0;
+	const int32 NumElements = (NumVertices > 0) ? ImGuiCommand.ElemCount : 0;
+	const uint32 FirstVertex = ImGuiCommand.VtxOffset + MinIndex;
+
+	// Reset and reserve space in destination buffers.
+	OutVertexBuffer.SetNumUninitialized(NumVertices, false);
+	OutIndexBuffer.SetNumUninitialized(NumElements, false);
 
 	// Transform and copy vertex data.
-	for (int Idx = 0; Idx < ImGuiVertexBuffer.Size; Idx++)
+	for (int Idx = 0; Idx < NumVertices; Idx++)
 	{
-		const ImDrawVert& ImGuiVertex = ImGuiVertexBuffer[Idx];
+		const ImDrawVert& ImGuiVertex = ImGuiVertexBuffer[FirstVertex + Idx];
 		FSlateVertex& SlateVertex = OutVertexBuffer[Idx];
 
 		// Final UV is calculated in shader as XY * ZW, so we need set all components.
@@ -39,19 +61,34 @@ void FImGuiDrawList::CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const
 		// Unpack ImU32 color.
 		SlateVertex.Color = ImGuiInterops::UnpackImU32Color(ImGuiVertex.col);
 	}
+
+	// Copy elements, rebasing them to the first copied vertex (slow copy because of different sizes of ImDrawIdx and
+	// SlateIndex and because SlateIndex can have different size on different platforms).
+	for (int i = 0; i < NumElements; i++)
+	{
+		OutIndexBuffer[i] = Indices[i] - MinIndex;
+	}
 }
 
-void FImGuiDrawList::CopyIndexData(TArray<SlateIndex>& OutIndexBuffer, const int32 StartIndex, const int32 NumElements) const
+uint64 FImGuiDrawList::ComputeHash(uint64 Seed) const
 {
-	// Reset buffer.
-	OutIndexBuffer.SetNumUninitialized(NumElements, false);
+	uint64 Hash = Seed;
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(ImGuiVertexBuffer.Data), ImGuiVertexBuffer.size_in_bytes(), Hash);
+	Hash = CityHash64WithSeed(reinterpret_cast<const char*>(ImGuiIndexBuffer.Data), ImGuiIndexBuffer.size_in_bytes(), Hash);
 
-	// Copy elements (slow copy because of different sizes of ImDrawIdx and SlateIndex and because SlateIndex can
-	// have different size on different platforms).
-	for (int i = 0; i < NumElements; i++)
+	// Draw commands contain padding and callback data, so we only hash members that affect rendering.
+	for (const ImDrawCmd& Command : ImGuiCommandBuffer)
 	{
-		OutIndexBuffer[i] = ImGuiIndexBuffer[StartIndex + i];
+		uint32 CommandData[8];
+		FMemory::Memcpy(CommandData, &Command.ClipRect, sizeof(Command.ClipRect));
+		CommandData[4] = static_cast<uint32>(ImGuiInterops::ToTextureIndex(Command.TextureId));
+		CommandData[5] = Command.VtxOffset;
+		CommandData[6] = Command.IdxOffset;
+		CommandData[7] = Command.ElemCount;
+		Hash = CityHash64WithSeed(reinterpret_cast<const char*>(CommandData), sizeof(CommandData), Hash);
 	}
+
+	return Hash;
 }
 
 void FImGuiDrawList::TransferDrawData(ImDrawList& Src)
@@ -60,4 +97,138 @@ void FImGuiDrawList::TransferDrawData(ImDrawList& Src)
 	Src.CmdBuffer.swap(ImGuiCommandBuffer);
 	Src.IdxBuffer.swap(ImGuiIndexBuffer);
 	Src.VtxBuffer.swap(ImGuiVertexBuffer);
+
+	UpdateCullingData();
+}
+
+void FImGuiDrawList::UpdateCullingData()
+{
+	// Geometry of draw commands is always inside of their clipping rectangles, so their union bounds the whole list.
+	ClipBounds = { FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX };
+	for (const ImDrawCmd& ImGuiCommand : ImGuiCommandBuffer)
+	{
+		if (ImGuiCommand.ElemCount > 0)
+		{
+			ClipBounds.x = FMath::Min(ClipBounds.x, ImGuiCommand.ClipRect.x);
+			ClipBounds.y = FMath::Min(ClipBounds.y, ImGuiCommand.ClipRect.y);
+			ClipBounds.z = FMath::Max(ClipBounds.z, ImGuiCommand.ClipRect.z);
+			ClipBounds.w = FMath::Max(ClipBounds.w, ImGuiCommand.ClipRect.w);
+		}
+	}
+}
+
+namespace
+{
+	// Buffers bigger than this are treated as a serialization error.
+	constexpr int64 MaxSerializedBufferSize = 64 * 1024 * 1024;
+
+	// Size of one draw command in the archive: clipping rectangle, texture index, vertex and index offsets and number of
+	// elements.
+	constexpr int64 SerializedCommandSize = 4 * sizeof(float) + sizeof(TextureIndex) + 3 * sizeof(uint32);
+
+	// Number of bytes that are left in a loading archive.
+	FORCEINLINE int64 GetRemainingSize(FArchive& Ar)
+	{
+		return Ar.TotalSize() - Ar.Tell();
+	}
+
+	template<typename T>
+	void SerializeRaw(FArchive& Ar, ImVector<T>& Vector)
+	{
+		int32 Size = Vector.Size;
+		Ar << Size;
+
+		if (Ar.IsLoading())
+		{
+			// Size comes from untrusted data, so it must fit in the archive before we allocate anything.
+			const int64 SizeInBytes = (int64)Size * sizeof(T);
+			if (Ar.IsError() || Size < 0 || SizeInBytes > MaxSerializedBufferSize || SizeInBytes > GetRemainingSize(Ar))
+			{
+				Ar.SetError();
+				Vector.clear();
+				return;
+			}
+
+			Vector.resize(Size);
+		}
+
+		Ar.Serialize(Vector.Data, Vector.size_in_bytes());
+	}
+}
+
+bool FImGuiDrawList::HasValidCommands() const
+{
+	for (const ImDrawCmd& Command : ImGuiCommandBuffer)
+	{
+		if ((int64)Command.IdxOffset + Command.ElemCount > ImGuiIndexBuffer.Size
+			|| (Command.ElemCount > 0 && Command.VtxOffset >= (uint32)ImGuiVertexBuffer.Size))
+		{
+			return false;
+		}
+
+		// Every index must reference a vertex in the buffer.
+		const uint32 MaxIndex = ImGuiVertexBuffer.Size - Command.VtxOffset;
+		const ImDrawIdx* Indices = ImGuiIndexBuffer.Data + Command.IdxOffset;
+		for (uint32 Idx = 0; Idx < Command.ElemCount; Idx++)
+		{
+			if (Indices[Idx] >= MaxIndex)
+			{
+				return false;
+			}
+		}
+	}
+
+	return true;
+}
+
+FArchive& operator<<(FArchive& Ar, FImGuiDrawList& DrawList)
+{
+	// Vertices and indices are plain data, so they are serialized as raw memory.
+	SerializeRaw(Ar, DrawList.ImGuiVertexBuffer);
+	SerializeRaw(Ar, DrawList.ImGuiIndexBuffer);
+
+	int32 NumCommands = DrawList.ImGuiCommandBuffer.Size;
+	Ar << NumCommands;
+
+	if (Ar.IsLoading())
+	{
+		if (Ar.IsError() || NumCommands < 0 || NumCommands * SerializedCommandSize > GetRemainingSize(Ar))
+		{
+			Ar.SetError();
+			NumCommands = 0;
+		}
+		DrawList.ImGuiCommandBuffer.resize(NumCommands);
+	}
+
+	for (ImDrawCmd& Command : DrawList.ImGuiCommandBuffer)
+	{
+		TextureIndex Texture = ImGuiInterops::ToTextureIndex(Command.TextureId);
+
+		Ar << Command.ClipRect.x << Command.ClipRect.y << Command.ClipRect.z << Command.ClipRect.w;
+		Ar << Texture;
+		Ar << Command.VtxOffset << Command.IdxOffset << Command.ElemCount;
+
+		if (Ar.IsLoading())
+		{
+			Command.TextureId = ImGuiInterops::ToImTextureID(Texture);
+			Command.UserCallback = nullptr;
+			Command.UserCallbackData = nullptr;
+		}
+	}
+
+	if (Ar.IsLoading())
+	{
+		// Drop lists that would make painter read out of buffer bounds.
+		if (Ar.IsError() || !DrawList.HasValidCommands())
+		{
+			Ar.SetError();
+			DrawList.ImGuiCommandBuffer.clear();
+			DrawList.ImGuiIndexBuffer.clear();
+			DrawList.ImGuiVertexBuffer.clear();
+		}
+
+		DrawList.UpdateCullingData();
+	}
+
+	return Ar;
 }
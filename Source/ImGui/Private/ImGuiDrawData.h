@@ -38,32 +38,72 @@ public:
 			ImGuiInterops::ToTextureIndex(ImGuiCommand.TextureId) };
 	}
 
+	// Check whether any part of this list can be visible in the given rectangle. Uses union of clipping rectangles of all
+	// draw commands, which ImGui maintains anyway, so the test doesn't depend on the number of vertices.
+	// @param VisibleRect - Visible rectangle in ImGui space
+	// @returns True, if this list can be visible
+	FORCEINLINE bool IsVisible(const FSlateRect& VisibleRect) const
+	{
+		return FSlateRect::DoRectanglesIntersect(ImGuiInterops::ToSlateRect(ClipBounds), VisibleRect);
+	}
+
+	// Check whether the draw command can be visible in the given rectangle.
+	// @param CommandNb - Number of draw command
+	// @param VisibleRect - Visible rectangle in ImGui space
+	// @returns True, if the command has elements and its clipping rectangle intersects with the visible rectangle
+	FORCEINLINE bool IsCommandVisible(int CommandNb, const FSlateRect& VisibleRect) const
+	{
+		const ImDrawCmd& ImGuiCommand = ImGuiCommandBuffer[CommandNb];
+		return ImGuiCommand.ElemCount > 0
+			&& FSlateRect::DoRectanglesIntersect(ImGuiInterops::ToSlateRect(ImGuiCommand.ClipRect), VisibleRect);
+	}
+
 #if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-	// Transform and copy vertex data to target buffer (old data in the target buffer are replaced).
-	// @param OutVertexBuffer - Destination buffer
-	// @param Transform - Transform to apply to all vertices
+	// Transform and copy vertex and index data of one draw command to target buffers (old data in the target buffers are
+	// replaced). Only vertices referenced by the command are copied and indices are rebased to match them.
+	// @param CommandNb - Number of draw command
+	// @param Transform - Transform to apply to vertices
 	// @param VertexClippingRect - Clipping rectangle for transformed Slate vertices
-	void CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform, const FSlateRotatedRect& VertexClippingRect) const;
+	// @param OutVertexBuffer - Destination vertex buffer
+	// @param OutIndexBuffer - Destination index buffer
+	void CopyCommandData(int CommandNb, const FTransform2D& Transform, const FSlateRotatedRect& VertexClippingRect,
+		TArray<FSlateVertex>& OutVertexBuffer, TArray<SlateIndex>& OutIndexBuffer) const;
 #else
-	// Transform and copy vertex data to target buffer (old data in the target buffer are replaced).
-	// @param OutVertexBuffer - Destination buffer
-	// @param Transform - Transform to apply to all vertices
-	void CopyVertexData(TArray<FSlateVertex>& OutVertexBuffer, const FTransform2D& Transform) const;
+	// Transform and copy vertex and index data of one draw command to target buffers (old data in the target buffers are
+	// replaced). Only vertices referenced by the command are copied and indices are rebased to match them.
+	// @param CommandNb - Number of draw command
+	// @param Transform - Transform to apply to vertices
+	// @param OutVertexBuffer - Destination vertex buffer
+	// @param OutIndexBuffer - Destination index buffer
+	void CopyCommandData(int CommandNb, const FTransform2D& Transform, TArray<FSlateVertex>& OutVertexBuffer,
+		TArray<SlateIndex>& OutIndexBuffer) const;
 #endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
 
-	// Transform and copy index data to target buffer (old data in the target buffer are replaced).
-	// Internal index buffer contains enough data to match the sum of NumElements from all draw commands.
-	// @param OutIndexBuffer - Destination buffer
-	// @param StartIndex - Start copying source data starting from this index
-	// @param NumElements - How many elements we want to copy
-	void CopyIndexData(TArray<SlateIndex>& OutIndexBuffer, const int32 StartIndex, const int32 NumElements) const;
+	// Compute hash of the draw list content, which can be used to detect whether output changed between frames.
+	// @param Seed - Hash to combine with, allows to chain hashes of multiple lists
+	// @returns Hash of this list combined with the seed
+	uint64 ComputeHash(uint64 Seed) const;
 
 	// Transfers data from ImGui source list to this object. Leaves source cleared.
 	void TransferDrawData(ImDrawList& Src);
 
+	// Serialize draw list buffers. Texture ids are stored as texture indices and callbacks are not serialized, so this
+	// can be used to send draw data between processes which have matching textures. Loaded data are validated and on
+	// failure the list is left empty and the archive is set to the error state.
+	friend FArchive& operator<<(FArchive& Ar, FImGuiDrawList& DrawList);
+
 private:
 
+	// Check whether all draw commands reference elements and vertices within buffer bounds.
+	bool HasValidCommands() const;
+
+	// Update data used for culling. Needs to be called after buffers change.
+	void UpdateCullingData();
+
 	ImVector<ImDrawCmd> ImGuiCommandBuffer;
 	ImVector<ImDrawIdx> ImGuiIndexBuffer;
 	ImVector<ImDrawVert> ImGuiVertexBuffer;
+
+	// Union of clipping rectangles of all draw commands.
+	ImVec4 ClipBounds{ 0.f, 0.f, 0.f, 0.f };
 };
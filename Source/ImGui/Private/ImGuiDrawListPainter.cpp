@@ -0,0 +1,66 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiDrawListPainter.h"
+
+#include "TextureManager.h"
+
+#include <Rendering/DrawElements.h>
+
+
+void FImGuiDrawListPainter::Paint(const TArray<FImGuiDrawList>& DrawLists, const FSlateRenderTransform& ImGuiToScreen,
+	const FSlateRect& ClippingRect, const FTextureManager& TextureManager, FSlateWindowElementList& OutDrawElements, int32 LayerId)
+{
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+	// Convert clipping rectangle to format required by Slate vertex.
+	const FSlateRotatedRect VertexClippingRect{ ClippingRect };
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+	// Visible part of the ImGui space. When canvas is zoomed or panned, most of the output can be outside of it, so we
+	// skip it before converting any vertices.
+	const FSlateRect VisibleRect = TransformRect(ImGuiToScreen.Inverse(), ClippingRect);
+
+	for (const auto& DrawList : DrawLists)
+	{
+		if (!DrawList.IsVisible(VisibleRect))
+		{
+			continue;
+		}
+
+		for (int CommandNb = 0; CommandNb < DrawList.NumCommands(); CommandNb++)
+		{
+			if (!DrawList.IsCommandVisible(CommandNb, VisibleRect))
+			{
+				continue;
+			}
+
+			const auto& DrawCommand = DrawList.GetCommand(CommandNb, ImGuiToScreen);
+
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+			DrawList.CopyCommandData(CommandNb, ImGuiToScreen, VertexClippingRect, VertexBuffer, IndexBuffer);
+#else
+			DrawList.CopyCommandData(CommandNb, ImGuiToScreen, VertexBuffer, IndexBuffer);
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+			// Get texture resource handle for this draw command (null index will be also mapped to a valid texture).
+			const FSlateResourceHandle& Handle = TextureManager.GetTextureHandle(DrawCommand.TextureId);
+
+			// Transform clipping rectangle to screen space and apply to elements that we draw.
+			const FSlateRect CommandClippingRect = DrawCommand.ClippingRect.IntersectionWith(ClippingRect);
+
+#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+			// Get access to the Slate scissor rectangle defined in Slate Core API, so we can customize elements drawing.
+			extern SLATECORE_API TOptional<FShortRect> GSlateScissorRect;
+			TGuardValue<TOptional<FShortRect>> GSlateScissorRecGuard(GSlateScissorRect, FShortRect{ CommandClippingRect });
+#else
+			OutDrawElements.PushClip(FSlateClippingZone{ CommandClippingRect });
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+
+			// Add elements to the list.
+			FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, VertexBuffer, IndexBuffer, nullptr, 0, 0);
+
+#if !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+			OutDrawElements.PopClip();
+#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
+		}
+	}
+}
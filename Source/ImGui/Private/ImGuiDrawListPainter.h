@@ -0,0 +1,33 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDrawData.h"
+
+#include <Rendering/RenderingCommon.h>
+
+
+class FSlateWindowElementList;
+class FTextureManager;
+
+// Converts ImGui draw lists to Slate draw elements. Vertex and index buffers are kept between calls, so painting
+// doesn't need to allocate memory once they grow to the size of the typical output.
+class FImGuiDrawListPainter
+{
+public:
+
+	// Add Slate draw elements for all commands in the given draw lists.
+	// @param DrawLists - Draw lists to paint
+	// @param ImGuiToScreen - Transform from ImGui to screen space
+	// @param ClippingRect - Screen-space clipping rectangle, in which elements are painted
+	// @param TextureManager - Manager providing resources for textures referenced by draw commands
+	// @param OutDrawElements - Destination list of draw elements
+	// @param LayerId - Layer at which elements are added
+	void Paint(const TArray<FImGuiDrawList>& DrawLists, const FSlateRenderTransform& ImGuiToScreen, const FSlateRect& ClippingRect,
+		const FTextureManager& TextureManager, FSlateWindowElementList& OutDrawElements, int32 LayerId);
+
+private:
+
+	TArray<FSlateVertex> VertexBuffer;
+	TArray<SlateIndex> IndexBuffer;
+};
@@ -0,0 +1,161 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiFontAtlasCache.h"
+
+#include <Async/Async.h>
+
+#include <imgui_internal.h>
+
+
+namespace
+{
+	// Number of ticks for which unused atlases are kept. Typically, one frame should be enough but since we allow for
+	// custom ticking, we wait for contexts that already ticked and will not do that before the end of the next tick.
+	constexpr int32 ReleaseUnusedAfterTicks = 3;
+
+	// Size of the default font at the DPI scale of 1.
+	constexpr float DefaultFontSize = 13.f;
+
+	// Shared atlases don't belong to any context, so their allocations shouldn't be recorded in the current one (which
+	// during background builds can be used by another thread).
+	struct FAllocHookDisabledScope
+	{
+		FAllocHookDisabledScope() : bWasEnabled(ImGui::DebugAllocHookSetThreadEnabled(false)) {}
+		~FAllocHookDisabledScope() { ImGui::DebugAllocHookSetThreadEnabled(bWasEnabled); }
+
+		bool bWasEnabled;
+	};
+
+	void BuildFontAtlas(ImFontAtlas& Atlas, int32 FontSize, const TArray<ImFontConfig>& CustomFontConfigs)
+	{
+		FAllocHookDisabledScope AllocHookDisabledScope;
+
+		ImFontConfig FontConfig = {};
+		FontConfig.SizePixels = FontSize;
+		Atlas.AddFontDefault(&FontConfig);
+
+		for (const ImFontConfig& CustomFontConfig : CustomFontConfigs)
+		{
+			Atlas.AddFont(&CustomFontConfig);
+		}
+
+		unsigned char* Pixels;
+		int Width, Height, Bpp;
+		Atlas.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
+	}
+}
+
+FImGuiFontAtlas::FImGuiFontAtlas(int32 InId, int32 InFontSize, uint32 InGeneration)
+	: Id(InId)
+	, FontSize(InFontSize)
+	, Generation(InGeneration)
+{
+}
+
+FImGuiFontAtlas::~FImGuiFontAtlas()
+{
+	if (Task.IsValid())
+	{
+		Task.Wait();
+	}
+
+	// Release resources here, so the atlas destructor has nothing left to free.
+	FAllocHookDisabledScope AllocHookDisabledScope;
+	Atlas.Clear();
+}
+
+FName FImGuiFontAtlas::GetTextureName() const
+{
+	// Number is stored in the name, so it is unique without formatting a string.
+	return FName(TEXT("ImGuiModule_FontAtlas"), Id + 1);
+}
+
+FImGuiFontAtlasCache::~FImGuiFontAtlasCache()
+{
+	// Atlases wait for their tasks when destroyed.
+	FontAtlases.Empty();
+}
+
+TSharedRef<FImGuiFontAtlas> FImGuiFontAtlasCache::Request(float DPIScale, bool bWait)
+{
+	const int32 FontSize = FMath::Max(FMath::RoundToInt(FMath::RoundFromZero(DefaultFontSize * DPIScale)), 1);
+
+	// Atlases differ only in the size of the default font, so scales that round to the same size share the atlas.
+	TSharedRef<FImGuiFontAtlas>* Found = FontAtlases.FindByPredicate([&](const TSharedRef<FImGuiFontAtlas>& FontAtlas)
+	{
+		return FontAtlas->FontSize == FontSize && FontAtlas->Generation == Generation;
+	});
+
+	TSharedRef<FImGuiFontAtlas> FontAtlas = Found ? *Found
+		: FontAtlases.Add_GetRef(MakeShared<FImGuiFontAtlas>(NextId++, FontSize, Generation));
+
+	if (!Found)
+	{
+		ImFontAtlas* Atlas = &FontAtlas->Atlas;
+		FontAtlas->Task = Async(EAsyncExecution::ThreadPool, [Atlas, FontSize, Configs = CustomFontConfigs]()
+		{
+			BuildFontAtlas(*Atlas, FontSize, Configs);
+		});
+	}
+
+	if (bWait && !FontAtlas->IsReady())
+	{
+		FontAtlas->Task.Wait();
+		SetReady(*FontAtlas);
+	}
+
+	return FontAtlas;
+}
+
+void FImGuiFontAtlasCache::SetCustomFonts(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFonts)
+{
+	CustomFontConfigs.Reset(CustomFonts.Num());
+	for (const TPair<FName, TSharedPtr<ImFontConfig>>& CustomFontPair : CustomFonts)
+	{
+		if (CustomFontPair.Value.IsValid())
+		{
+			ImFontConfig& Config = CustomFontConfigs.Add_GetRef(*CustomFontPair.Value);
+
+			// Set font name for debugging
+			ImStrncpy(Config.Name, TCHAR_TO_ANSI(*CustomFontPair.Key.ToString()), IM_ARRAYSIZE(Config.Name));
+
+			// Font data is shared by all atlases, so none of them can release it.
+			Config.FontDataOwnedByAtlas = false;
+		}
+	}
+
+	Generation++;
+}
+
+void FImGuiFontAtlasCache::Tick()
+{
+	for (int32 Index = FontAtlases.Num() - 1; Index >= 0; Index--)
+	{
+		FImGuiFontAtlas& FontAtlas = *FontAtlases[Index];
+		if (!FontAtlas.IsReady())
+		{
+			if (FontAtlas.Task.IsReady())
+			{
+				SetReady(FontAtlas);
+			}
+			continue;
+		}
+
+		// Atlases referenced only by this cache are not used by any context.
+		if (FontAtlases[Index].GetSharedReferenceCount() > 1)
+		{
+			FontAtlas.UnusedTicks = 0;
+		}
+		else if (++FontAtlas.UnusedTicks > ReleaseUnusedAfterTicks)
+		{
+			OnFontAtlasReleased.Broadcast(FontAtlas);
+			FontAtlases.RemoveAtSwap(Index, 1, false);
+		}
+	}
+}
+
+void FImGuiFontAtlasCache::SetReady(FImGuiFontAtlas& FontAtlas)
+{
+	FontAtlas.bReady = true;
+	OnFontAtlasReady.Broadcast(FontAtlas);
+}
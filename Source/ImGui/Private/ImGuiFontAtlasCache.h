@@ -0,0 +1,126 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Async/Future.h>
+#include <Delegates/Delegate.h>
+#include <Templates/SharedPointer.h>
+
+#include <imgui.h>
+
+
+// Font atlas built for one font size. Once built, it is never modified, so it can be shared by all contexts that use
+// the same DPI scale.
+class FImGuiFontAtlas
+{
+public:
+
+	FImGuiFontAtlas(int32 InId, int32 InFontSize, uint32 InGeneration);
+
+	FImGuiFontAtlas(const FImGuiFontAtlas&) = delete;
+	FImGuiFontAtlas& operator=(const FImGuiFontAtlas&) = delete;
+
+	FImGuiFontAtlas(FImGuiFontAtlas&&) = delete;
+	FImGuiFontAtlas& operator=(FImGuiFontAtlas&&) = delete;
+
+	// Waits for the build task, if it is still running.
+	~FImGuiFontAtlas();
+
+	// Get ImGui font atlas. Can only be used after the atlas is ready.
+	ImFontAtlas& GetAtlas() { return Atlas; }
+
+	// Whether the atlas is built and its texture, if textures are loaded, is created.
+	bool IsReady() const { return bReady; }
+
+	// Get the size of the default font in pixels.
+	int32 GetFontSize() const { return FontSize; }
+
+	// Get the name for the texture of this atlas (unique among atlases).
+	FName GetTextureName() const;
+
+private:
+
+	friend class FImGuiFontAtlasCache;
+
+	ImFontAtlas Atlas;
+
+	int32 Id;
+	int32 FontSize;
+
+	// Generation of custom fonts with which this atlas is built.
+	uint32 Generation;
+
+	// Task building the atlas. The atlas is not accessed on the game thread until it is finished.
+	TFuture<void> Task;
+
+	bool bReady = false;
+
+	// Number of cache ticks for which the atlas wasn't used by any context.
+	int32 UnusedTicks = 0;
+};
+
+// Delegate called with a font atlas.
+DECLARE_MULTICAST_DELEGATE_OneParam(FImGuiFontAtlasDelegate, FImGuiFontAtlas&);
+
+// Keeps font atlases for DPI scales used by contexts. Atlases are built lazily on the thread pool and shared by all
+// contexts that request the same font size, so one context changing DPI scale doesn't rebuild fonts of the others.
+// Atlases that are no longer referenced outside of the cache are released after a few ticks, which gives renderers
+// time to finish draw data that still use their textures.
+class FImGuiFontAtlasCache
+{
+public:
+
+	FImGuiFontAtlasCache() = default;
+	~FImGuiFontAtlasCache();
+
+	FImGuiFontAtlasCache(const FImGuiFontAtlasCache&) = delete;
+	FImGuiFontAtlasCache& operator=(const FImGuiFontAtlasCache&) = delete;
+
+	FImGuiFontAtlasCache(FImGuiFontAtlasCache&&) = delete;
+	FImGuiFontAtlasCache& operator=(FImGuiFontAtlasCache&&) = delete;
+
+	// Get an atlas for a DPI scale, starting a new build if there is no such atlas with the current custom fonts.
+	// @param DPIScale - DPI scale for which fonts should be built
+	// @param bWait - Whether to block until the atlas is ready (needed when there is no other atlas to use)
+	// @returns Atlas, which may be still building
+	TSharedRef<FImGuiFontAtlas> Request(float DPIScale, bool bWait = false);
+
+	// Set custom fonts for atlases requested after this call. Existing atlases are kept until they are not used.
+	// @param CustomFonts - Custom fonts added to every atlas after the default font
+	void SetCustomFonts(const TMap<FName, TSharedPtr<ImFontConfig>>& CustomFonts);
+
+	// Mark finished atlases as ready and release unused ones. Should be called once per frame.
+	void Tick();
+
+	// Call a function for every ready atlas.
+	template<typename FunctionType>
+	void ForEachReadyAtlas(FunctionType Function)
+	{
+		for (const TSharedRef<FImGuiFontAtlas>& FontAtlas : FontAtlases)
+		{
+			if (FontAtlas->IsReady())
+			{
+				Function(*FontAtlas);
+			}
+		}
+	}
+
+	// Delegate called on the game thread when an atlas is ready, before any context can use it.
+	FImGuiFontAtlasDelegate OnFontAtlasReady;
+
+	// Delegate called before an atlas is released.
+	FImGuiFontAtlasDelegate OnFontAtlasReleased;
+
+private:
+
+	void SetReady(FImGuiFontAtlas& FontAtlas);
+
+	TArray<TSharedRef<FImGuiFontAtlas>> FontAtlases;
+
+	// Copies of custom font configurations, passed to build tasks.
+	TArray<ImFontConfig> CustomFontConfigs;
+	uint32 Generation = 0;
+
+	int32 NextId = 0;
+};
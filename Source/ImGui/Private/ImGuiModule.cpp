@@ -4,6 +4,7 @@
 
 #include "ImGuiDelegatesContainer.h"
 #include "ImGuiModuleManager.h"
+#include "ImGuiWorldOverlay.h"
 #include "TextureManager.h"
 #include "Utilities/WorldContext.h"
 #include "Utilities/WorldContextIndex.h"
@@ -13,6 +14,7 @@
 #include "Editor/ImGuiEditor.h"
 #endif
 
+#include <Framework/Application/SlateApplication.h>
 #include <Interfaces/IPluginManager.h>
 
 
@@ -104,6 +106,52 @@ void FImGuiModule::ReleaseTexture(const FImGuiTextureHandle& Handle)
 	}
 }
 
+UTextureRenderTarget2D* FImGuiModule::CreateRenderTarget(const FName& Name, const UWorld* World, const FIntPoint& Resolution, float UpdateRate)
+{
+	checkf(World, TEXT("Null world argument."));
+
+	if (!ImGuiModuleManager)
+	{
+		return nullptr;
+	}
+
+	// Make sure that context exists, so we can render it even if it is not displayed in any viewport.
+	int32 ContextIndex;
+	ImGuiModuleManager->GetContextManager().GetWorldContextProxy(*World, ContextIndex);
+
+	// Render target may be created before any widget, so we need to load textures used in the ImGui output.
+	if (FSlateApplication::IsInitialized())
+	{
+		ImGuiModuleManager->LoadTextures();
+	}
+
+	return ImGuiModuleManager->GetRenderTargetManager().Add(Name, ContextIndex, Resolution, UpdateRate);
+}
+
+void FImGuiModule::SetRenderTargetResolution(const FName& Name, const FIntPoint& Resolution)
+{
+	if (ImGuiModuleManager)
+	{
+		ImGuiModuleManager->GetRenderTargetManager().SetResolution(Name, Resolution);
+	}
+}
+
+void FImGuiModule::SetRenderTargetUpdateRate(const FName& Name, float UpdateRate)
+{
+	if (ImGuiModuleManager)
+	{
+		ImGuiModuleManager->GetRenderTargetManager().SetUpdateRate(Name, UpdateRate);
+	}
+}
+
+void FImGuiModule::ReleaseRenderTarget(const FName& Name)
+{
+	if (ImGuiModuleManager)
+	{
+		ImGuiModuleManager->GetRenderTargetManager().Remove(Name);
+	}
+}
+
 void FImGuiModule::RebuildFontAtlas()
 {
 	if (ImGuiModuleManager)
@@ -318,6 +366,53 @@ bool FImGuiTextureHandle::HasValidEntry() const
 	return Index != INDEX_NONE && ImGuiModuleManager && ImGuiModuleManager->GetTextureManager().GetTextureName(Index) == Name;
 }
 
+namespace
+{
+	FImGuiWorldOverlayBatch* GetWorldOverlay(UWorld* World)
+	{
+		return (ImGuiModuleManager && World) ? &ImGuiModuleManager->GetContextManager().GetWorldContextProxy(*World).GetWorldOverlay() : nullptr;
+	}
+}
+
+void FImGuiWorldOverlay::AddPoints(TArrayView<const FVector> Points, const FColor& Color, float Size)
+{
+	AddPoints(GWorld, Points, Color, Size);
+}
+
+void FImGuiWorldOverlay::AddPoints(UWorld* World, TArrayView<const FVector> Points, const FColor& Color, float Size)
+{
+	if (FImGuiWorldOverlayBatch* WorldOverlay = GetWorldOverlay(World))
+	{
+		WorldOverlay->AddPoints(Points, Color, Size);
+	}
+}
+
+void FImGuiWorldOverlay::AddLines(TArrayView<const FVector> LinePoints, const FColor& Color, float Thickness)
+{
+	AddLines(GWorld, LinePoints, Color, Thickness);
+}
+
+void FImGuiWorldOverlay::AddLines(UWorld* World, TArrayView<const FVector> LinePoints, const FColor& Color, float Thickness)
+{
+	if (FImGuiWorldOverlayBatch* WorldOverlay = GetWorldOverlay(World))
+	{
+		WorldOverlay->AddLines(LinePoints, Color, Thickness);
+	}
+}
+
+void FImGuiWorldOverlay::AddLabels(TArrayView<const FVector> Locations, TArrayView<const FString> Labels, const FColor& Color)
+{
+	AddLabels(GWorld, Locations, Labels, Color);
+}
+
+void FImGuiWorldOverlay::AddLabels(UWorld* World, TArrayView<const FVector> Locations, TArrayView<const FString> Labels, const FColor& Color)
+{
+	if (FImGuiWorldOverlayBatch* WorldOverlay = GetWorldOverlay(World))
+	{
+		WorldOverlay->AddLabels(Locations, Labels, Color);
+	}
+}
+
 
 #undef LOCTEXT_NAMESPACE
 
@@ -16,13 +16,15 @@ constexpr int32 IMGUI_WIDGET_Z_ORDER = 10000;
 
 // Module texture names.
 const static FName PlainTextureName = "ImGuiModule_Plain";
-const static FName FontAtlasTextureName = "ImGuiModule_FontAtlas";
 
 FImGuiModuleManager::FImGuiModuleManager()
 	: Commands(Properties)
 	, Settings(Properties, Commands)
 	, ImGuiDemo(Properties)
 	, ContextManager(Settings)
+	, PlotTextures(TextureManager)
+	, RenderTargetManager(*this)
+	, RemoteServer(ContextManager)
 {
 	// Register in context manager to get information whenever a new context proxy is created.
 	ContextManager.OnContextProxyCreated.AddRaw(this, &FImGuiModuleManager::OnContextProxyCreated);
@@ -33,8 +35,15 @@ FImGuiModuleManager::FImGuiModuleManager()
 	// Try to register tick delegate (it may fail if Slate application isn't yet ready).
 	RegisterTick();
 
+	// Dedicated servers don't have Slate, so we tick with the core ticker. Contexts can still be used there, for instance
+	// to stream their output to remote clients.
+	if (!IsTickRegistered() && IsRunningDedicatedServer())
+	{
+		RegisterHeadlessTick();
+	}
+
 	// If we failed to register, create an initializer that will do it later.
-	if (!IsTickRegistered())
+	if (!IsTickRegistered() && !HeadlessTickHandle.IsValid())
 	{
 		CreateTickInitializer();
 	}
@@ -46,7 +55,8 @@ FImGuiModuleManager::FImGuiModuleManager()
 
 FImGuiModuleManager::~FImGuiModuleManager()
 {
-	ContextManager.OnFontAtlasBuilt.RemoveAll(this);
+	ContextManager.GetFontAtlasCache().OnFontAtlasReady.RemoveAll(this);
+	ContextManager.GetFontAtlasCache().OnFontAtlasReleased.RemoveAll(this);
 
 	// We are no longer interested with adding widgets to viewports.
 	if (ViewportCreatedHandle.IsValid())
@@ -72,6 +82,7 @@ FImGuiModuleManager::~FImGuiModuleManager()
 	// Deactivate this manager.
 	ReleaseTickInitializer();
 	UnregisterTick();
+	UnregisterHeadlessTick();
 }
 
 void FImGuiModuleManager::RebuildFontAtlas()
@@ -92,28 +103,42 @@ void FImGuiModuleManager::LoadTextures()
 		// Create an empty texture at index 0. We will use it for ImGui outputs with null texture id.
 		TextureManager.CreatePlainTexture(PlainTextureName, 2, 2, FColor::White);
 
-		// Register for atlas built events, so we can rebuild textures.
-		ContextManager.OnFontAtlasBuilt.AddRaw(this, &FImGuiModuleManager::BuildFontAtlasTexture);
+		// Register for atlas events, so we can create and release their textures.
+		FImGuiFontAtlasCache& FontAtlasCache = ContextManager.GetFontAtlasCache();
+		FontAtlasCache.OnFontAtlasReady.AddRaw(this, &FImGuiModuleManager::BuildFontAtlasTexture);
+		FontAtlasCache.OnFontAtlasReleased.AddRaw(this, &FImGuiModuleManager::ReleaseFontAtlasTexture);
+
+		FontAtlasCache.ForEachReadyAtlas([this](FImGuiFontAtlas& FontAtlas) { BuildFontAtlasTexture(FontAtlas); });
 
-		BuildFontAtlasTexture();
+		// Plot textures can be created after the plain texture, which reserves index that ImPlot treats as invalid.
+		PlotTextures.SetEnabled(true);
 	}
 }
 
-void FImGuiModuleManager::BuildFontAtlasTexture()
+void FImGuiModuleManager::BuildFontAtlasTexture(FImGuiFontAtlas& FontAtlas)
 {
 	// Create a font atlas texture.
-	ImFontAtlas& Fonts = ContextManager.GetFontAtlas();
+	ImFontAtlas& Fonts = FontAtlas.GetAtlas();
 
 	unsigned char* Pixels;
 	int Width, Height, Bpp;
 	Fonts.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
 
-	const TextureIndex FontsTexureIndex = TextureManager.CreateTexture(FontAtlasTextureName, Width, Height, Bpp, Pixels);
+	const TextureIndex FontsTexureIndex = TextureManager.CreateTexture(FontAtlas.GetTextureName(), Width, Height, Bpp, Pixels);
 
 	// Set the font texture index in the ImGui.
 	Fonts.TexID = ImGuiInterops::ToImTextureID(FontsTexureIndex);
 }
 
+void FImGuiModuleManager::ReleaseFontAtlasTexture(FImGuiFontAtlas& FontAtlas)
+{
+	const TextureIndex FontsTexureIndex = TextureManager.FindTextureIndex(FontAtlas.GetTextureName());
+	if (FontsTexureIndex != INDEX_NONE)
+	{
+		TextureManager.ReleaseTextureResources(FontsTexureIndex);
+	}
+}
+
 void FImGuiModuleManager::RegisterTick()
 {
 	// Slate Post-Tick is a good moment to end and advance ImGui frame as it minimises a tearing.
@@ -165,6 +190,31 @@ void FImGuiModuleManager::ReleaseTickInitializer()
 	}
 }
 
+void FImGuiModuleManager::RegisterHeadlessTick()
+{
+	if (!HeadlessTickHandle.IsValid())
+	{
+#if ENGINE_COMPATIBILITY_LEGACY_CORE_TICKER
+		HeadlessTickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FImGuiModuleManager::TickHeadless));
+#else
+		HeadlessTickHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FImGuiModuleManager::TickHeadless));
+#endif
+	}
+}
+
+void FImGuiModuleManager::UnregisterHeadlessTick()
+{
+	if (HeadlessTickHandle.IsValid())
+	{
+#if ENGINE_COMPATIBILITY_LEGACY_CORE_TICKER
+		FTicker::GetCoreTicker().RemoveTicker(HeadlessTickHandle);
+#else
+		FTSTicker::GetCoreTicker().RemoveTicker(HeadlessTickHandle);
+#endif
+		HeadlessTickHandle.Reset();
+	}
+}
+
 void FImGuiModuleManager::Tick(float DeltaSeconds)
 {
 	if (IsInGameThread())
@@ -172,11 +222,28 @@ void FImGuiModuleManager::Tick(float DeltaSeconds)
 		// Update context manager to advance all ImGui contexts to the next frame.
 		ContextManager.Tick(DeltaSeconds);
 
+		// Release plot textures that were not used in recent frames.
+		PlotTextures.Tick();
+
+		// Render contexts to offscreen targets, using draw data from the frame that just ended.
+		RenderTargetManager.Tick(DeltaSeconds);
+
+		// Send the frame that just ended to remote clients.
+		RemoteServer.Tick();
+
 		// Inform that we finished updating ImGui, so other subsystems can react.
 		PostImGuiUpdateEvent.Broadcast();
 	}
 }
 
+bool FImGuiModuleManager::TickHeadless(float DeltaSeconds)
+{
+	Tick(DeltaSeconds);
+
+	// Keep ticking.
+	return true;
+}
+
 void FImGuiModuleManager::OnViewportCreated()
 {
 	checkf(FSlateApplication::IsInitialized(), TEXT("We expect Slate to be initialized when game viewport is created."));
@@ -237,4 +304,7 @@ void FImGuiModuleManager::AddWidgetsToActiveViewports()
 void FImGuiModuleManager::OnContextProxyCreated(int32 ContextIndex, FImGuiContextProxy& ContextProxy)
 {
 	ContextProxy.OnDraw().AddLambda([this, ContextIndex]() { ImGuiDemo.DrawControls(ContextIndex); });
+
+	// Let ImPlot draw heatmaps with our textures (ImPlot context is created together with the context proxy).
+	PlotTextures.Register();
 }
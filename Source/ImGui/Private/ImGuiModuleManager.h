@@ -7,9 +7,15 @@
 #include "ImGuiModuleCommands.h"
 #include "ImGuiModuleProperties.h"
 #include "ImGuiModuleSettings.h"
+#include "ImGuiPlotTextures.h"
+#include "ImGuiRenderTargetManager.h"
+#include "Remote/ImGuiRemoteServer.h"
 #include "TextureManager.h"
+#include "VersionCompatibility.h"
 #include "Widgets/SImGuiLayout.h"
 
+#include <Containers/Ticker.h>
+
 
 // Central manager that implements module logic. It initializes and controls remaining module components.
 class FImGuiModuleManager
@@ -31,6 +37,9 @@ public:
 	// Get texture resources manager.
 	FTextureManager& GetTextureManager() { return TextureManager; }
 
+	// Get manager of render targets to which contexts are rendered offscreen.
+	FImGuiRenderTargetManager& GetRenderTargetManager() { return RenderTargetManager; }
+
 	// Event called right after ImGui is updated, to give other subsystems chance to react.
 	FSimpleMulticastDelegate& OnPostImGuiUpdate() { return PostImGuiUpdateEvent; }
 
@@ -48,7 +57,8 @@ private:
 	FImGuiModuleManager& operator=(FImGuiModuleManager&&) = delete;
 
 	void LoadTextures();
-	void BuildFontAtlasTexture();
+	void BuildFontAtlasTexture(FImGuiFontAtlas& FontAtlas);
+	void ReleaseFontAtlasTexture(FImGuiFontAtlas& FontAtlas);
 
 	bool IsTickRegistered() { return TickDelegateHandle.IsValid(); }
 	void RegisterTick();
@@ -57,7 +67,11 @@ private:
 	void CreateTickInitializer();
 	void ReleaseTickInitializer();
 
+	void RegisterHeadlessTick();
+	void UnregisterHeadlessTick();
+
 	void Tick(float DeltaSeconds);
+	bool TickHeadless(float DeltaSeconds);
 
 	void OnViewportCreated();
 
@@ -87,11 +101,25 @@ private:
 	// Manager for textures resources.
 	FTextureManager TextureManager;
 
+	// Textures used by ImPlot to draw heatmaps (released before the texture manager).
+	FImGuiPlotTextures PlotTextures;
+
+	// Manager for offscreen render targets (released before contexts and textures that it uses).
+	FImGuiRenderTargetManager RenderTargetManager;
+
+	// Server streaming ImGui output to remote clients.
+	FImGuiRemoteServer RemoteServer;
+
 	// Slate widgets that we created.
 	TArray<TWeakPtr<SImGuiLayout>> Widgets;
 
 	FDelegateHandle TickInitializerHandle;
 	FDelegateHandle TickDelegateHandle;
+#if ENGINE_COMPATIBILITY_LEGACY_CORE_TICKER
+	FDelegateHandle HeadlessTickHandle;
+#else
+	FTSTicker::FDelegateHandle HeadlessTickHandle;
+#endif
 	FDelegateHandle ViewportCreatedHandle;
 
 	bool bTexturesLoaded = false;
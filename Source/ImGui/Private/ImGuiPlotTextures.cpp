@@ -0,0 +1,99 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiPlotTextures.h"
+
+#include "ImGuiInteroperability.h"
+
+#include <implot.h>
+
+
+namespace
+{
+	// Number of frames after which unused textures are released.
+	constexpr uint32 ReleaseFrames = 120;
+
+	FName GetTextureName(ImGuiID Id)
+	{
+		// The same plot can be drawn in multiple contexts, so we need to distinguish between them.
+		const uint32 ContextId = GetTypeHash(ImGui::GetCurrentContext());
+		return FName(*FString::Printf(TEXT("ImPlot_%08x_%08x"), ContextId, Id));
+	}
+}
+
+FImGuiPlotTextures::FImGuiPlotTextures(FTextureManager& InTextureManager)
+	: TextureManager(InTextureManager)
+{
+}
+
+FImGuiPlotTextures::~FImGuiPlotTextures()
+{
+	for (const auto& Entry : Textures)
+	{
+		Release(Entry.Key, Entry.Value);
+	}
+}
+
+void FImGuiPlotTextures::Register()
+{
+	ImPlot::SetHeatmapTextureCallback(&FImGuiPlotTextures::GetTexture, this);
+}
+
+void FImGuiPlotTextures::Tick()
+{
+	for (auto It = Textures.CreateIterator(); It; ++It)
+	{
+		if (GFrameNumber - It->Value.LastUsedFrame > ReleaseFrames)
+		{
+			Release(It->Key, It->Value);
+			It.RemoveCurrent();
+		}
+	}
+}
+
+ImTextureID FImGuiPlotTextures::GetTexture(ImGuiID Id, ImU64 Hash, const ImU32* Pixels, int Width, int Height, void* UserData)
+{
+	return static_cast<FImGuiPlotTextures*>(UserData)->GetTexture(Id, Hash, Pixels, Width, Height);
+}
+
+ImTextureID FImGuiPlotTextures::GetTexture(ImGuiID Id, uint64 Hash, const ImU32* Pixels, int32 Width, int32 Height)
+{
+	if (!bEnabled)
+	{
+		return nullptr;
+	}
+
+	const FName Name = GetTextureName(Id);
+	FTexture& Texture = Textures.FindOrAdd(Name);
+	Texture.LastUsedFrame = GFrameNumber;
+
+	if (!Pixels)
+	{
+		// Null texture asks ImPlot to send pixels. Index 0 is never used here, because it is reserved for the plain
+		// texture.
+		return (Texture.Index != INDEX_NONE && Texture.Hash == Hash) ? ImGuiInterops::ToImTextureID(Texture.Index) : nullptr;
+	}
+
+	// ImGui colors need to be converted to the texture format. Texture is updated in the render thread, so we need our
+	// own copy of data.
+	const int32 NumPixels = Width * Height;
+	FColor* Data = new FColor[NumPixels];
+	for (int32 Index = 0; Index < NumPixels; Index++)
+	{
+		Data[Index] = ImGuiInterops::UnpackImU32Color(Pixels[Index]);
+	}
+
+	Texture.Index = TextureManager.UpdateDynamicTexture(Name, Width, Height, sizeof(FColor), reinterpret_cast<uint8*>(Data),
+		[](uint8* DataToRelease) { delete[] reinterpret_cast<FColor*>(DataToRelease); });
+	Texture.Hash = Hash;
+
+	return ImGuiInterops::ToImTextureID(Texture.Index);
+}
+
+void FImGuiPlotTextures::Release(const FName& Name, const FTexture& Texture)
+{
+	// Make sure that the entry still belongs to this texture.
+	if (Texture.Index != INDEX_NONE && TextureManager.GetTextureName(Texture.Index) == Name)
+	{
+		TextureManager.ReleaseTextureResources(Texture.Index);
+	}
+}
@@ -0,0 +1,58 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "TextureManager.h"
+
+#include <Containers/Map.h>
+
+#include <imgui.h>
+
+
+// Provides ImPlot with textures used to draw heatmaps and 2D histograms as single textured quads, instead of one quad
+// per cell. Textures are created through the texture manager, identified by ImPlot item and ImGui context, updated only
+// when ImPlot reports changed data and released when they are not used for a while.
+class FImGuiPlotTextures
+{
+public:
+
+	FImGuiPlotTextures(FTextureManager& InTextureManager);
+	~FImGuiPlotTextures();
+
+	FImGuiPlotTextures(const FImGuiPlotTextures&) = delete;
+	FImGuiPlotTextures& operator=(const FImGuiPlotTextures&) = delete;
+
+	FImGuiPlotTextures(FImGuiPlotTextures&&) = delete;
+	FImGuiPlotTextures& operator=(FImGuiPlotTextures&&) = delete;
+
+	// Set this as the heatmap texture provider in the current ImPlot context.
+	void Register();
+
+	// Allow or disallow creating textures. Until enabled, ImPlot renders heatmaps with quads.
+	void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+
+	// Release textures that were not used recently. Should be called after contexts are ticked.
+	void Tick();
+
+private:
+
+	struct FTexture
+	{
+		TextureIndex Index = INDEX_NONE;
+		uint64 Hash = 0;
+		uint32 LastUsedFrame = 0;
+	};
+
+	static ImTextureID GetTexture(ImGuiID Id, ImU64 Hash, const ImU32* Pixels, int Width, int Height, void* UserData);
+
+	ImTextureID GetTexture(ImGuiID Id, uint64 Hash, const ImU32* Pixels, int32 Width, int32 Height);
+
+	void Release(const FName& Name, const FTexture& Texture);
+
+	FTextureManager& TextureManager;
+
+	// Textures by name, which is derived from ImPlot item ID and ImGui context.
+	TMap<FName, FTexture> Textures;
+
+	bool bEnabled = false;
+};
@@ -0,0 +1,169 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiRenderTargetManager.h"
+
+#include "ImGuiContextManager.h"
+#include "ImGuiContextProxy.h"
+#include "ImGuiModuleManager.h"
+#include "Widgets/SImGuiDrawDataWidget.h"
+
+#include <Engine/TextureRenderTarget2D.h>
+#include <Framework/Application/SlateApplication.h>
+#include <Hash/CityHash.h>
+#include <Misc/App.h>
+#include <RenderingThread.h>
+#include <Slate/WidgetRenderer.h>
+#include <UObject/Package.h>
+
+
+namespace
+{
+	FORCEINLINE float ToUpdateInterval(float UpdateRate)
+	{
+		return UpdateRate > 0.f ? 1.f / UpdateRate : 0.f;
+	}
+}
+
+FImGuiRenderTargetManager::FImGuiRenderTargetManager(FImGuiModuleManager& InModuleManager)
+	: ModuleManager(InModuleManager)
+{
+}
+
+FImGuiRenderTargetManager::~FImGuiRenderTargetManager()
+{
+	RenderTargets.Empty();
+
+	if (WidgetRenderer)
+	{
+		BeginCleanup(WidgetRenderer);
+		WidgetRenderer = nullptr;
+	}
+}
+
+UTextureRenderTarget2D* FImGuiRenderTargetManager::Add(const FName& Name, int32 ContextIndex, const FIntPoint& Resolution, float UpdateRate)
+{
+	checkf(Name != NAME_None, TEXT("Render target name cannot be NAME_None."));
+	checkf(Resolution.X > 0 && Resolution.Y > 0, TEXT("Invalid resolution %dx%d for render target '%s'."),
+		Resolution.X, Resolution.Y, *Name.ToString());
+
+	FRenderTarget& RenderTarget = RenderTargets.FindOrAdd(Name);
+
+	if (!RenderTarget.Texture.IsValid())
+	{
+		UTextureRenderTarget2D* Texture = NewObject<UTextureRenderTarget2D>(GetTransientPackage(),
+			MakeUniqueObjectName(GetTransientPackage(), UTextureRenderTarget2D::StaticClass(), Name));
+		Texture->ClearColor = FLinearColor::Transparent;
+		Texture->InitCustomFormat(Resolution.X, Resolution.Y, PF_B8G8R8A8, false);
+		RenderTarget.Texture.Reset(Texture);
+	}
+	else if (RenderTarget.Resolution != Resolution)
+	{
+		RenderTarget.Texture->ResizeTarget(Resolution.X, Resolution.Y);
+	}
+
+	if (!RenderTarget.Widget.IsValid() || RenderTarget.ContextIndex != ContextIndex)
+	{
+		SAssignNew(RenderTarget.Widget, SImGuiDrawDataWidget).ModuleManager(&ModuleManager).ContextIndex(ContextIndex);
+	}
+
+	RenderTarget.ContextIndex = ContextIndex;
+	RenderTarget.Resolution = Resolution;
+	RenderTarget.UpdateInterval = ToUpdateInterval(UpdateRate);
+	RenderTarget.bNeedsUpdate = true;
+
+	return RenderTarget.Texture.Get();
+}
+
+UTextureRenderTarget2D* FImGuiRenderTargetManager::Find(const FName& Name) const
+{
+	const FRenderTarget* RenderTarget = RenderTargets.Find(Name);
+	return RenderTarget ? RenderTarget->Texture.Get() : nullptr;
+}
+
+void FImGuiRenderTargetManager::Remove(const FName& Name)
+{
+	RenderTargets.Remove(Name);
+}
+
+void FImGuiRenderTargetManager::SetResolution(const FName& Name, const FIntPoint& Resolution)
+{
+	checkf(Resolution.X > 0 && Resolution.Y > 0, TEXT("Invalid resolution %dx%d for render target '%s'."),
+		Resolution.X, Resolution.Y, *Name.ToString());
+
+	FRenderTarget* RenderTarget = RenderTargets.Find(Name);
+	if (RenderTarget && RenderTarget->Resolution != Resolution)
+	{
+		RenderTarget->Texture->ResizeTarget(Resolution.X, Resolution.Y);
+		RenderTarget->Resolution = Resolution;
+		RenderTarget->bNeedsUpdate = true;
+	}
+}
+
+void FImGuiRenderTargetManager::SetUpdateRate(const FName& Name, float UpdateRate)
+{
+	if (FRenderTarget* RenderTarget = RenderTargets.Find(Name))
+	{
+		RenderTarget->UpdateInterval = ToUpdateInterval(UpdateRate);
+	}
+}
+
+void FImGuiRenderTargetManager::Tick(float DeltaSeconds)
+{
+	for (auto& Entry : RenderTargets)
+	{
+		UpdateRenderTarget(Entry.Value, DeltaSeconds);
+	}
+}
+
+void FImGuiRenderTargetManager::UpdateRenderTarget(FRenderTarget& RenderTarget, float DeltaSeconds)
+{
+	RenderTarget.TimeSinceUpdate += DeltaSeconds;
+	if (RenderTarget.TimeSinceUpdate < RenderTarget.UpdateInterval && !RenderTarget.bNeedsUpdate)
+	{
+		return;
+	}
+
+	const FImGuiContextProxy* ContextProxy = ModuleManager.GetContextManager().GetContextProxy(RenderTarget.ContextIndex);
+	if (!ContextProxy)
+	{
+		return;
+	}
+
+	// Hash is only computed at the update rate, so the cost of detecting changes is limited in the same way as the cost
+	// of rendering. Display size is included, because it affects how output is scaled.
+	const FVector2D& DisplaySize = ContextProxy->GetDisplaySize();
+	uint64 Hash = CityHash64(reinterpret_cast<const char*>(&DisplaySize), sizeof(DisplaySize));
+	for (const FImGuiDrawList& DrawList : ContextProxy->GetDrawData())
+	{
+		Hash = DrawList.ComputeHash(Hash);
+	}
+
+	const float DeltaTime = RenderTarget.TimeSinceUpdate;
+	RenderTarget.TimeSinceUpdate = 0.f;
+
+	if (Hash == RenderTarget.DrawDataHash && !RenderTarget.bNeedsUpdate)
+	{
+		return;
+	}
+
+	RenderTarget.DrawDataHash = Hash;
+	RenderTarget.bNeedsUpdate = false;
+
+	// Without a renderer (e.g. with the null RHI) we still track changes but there is nothing to draw.
+	if (CanRender())
+	{
+		if (!WidgetRenderer)
+		{
+			// Gamma correction keeps colors consistent with the output in game viewports.
+			WidgetRenderer = new FWidgetRenderer(true);
+		}
+
+		WidgetRenderer->DrawWidget(RenderTarget.Texture.Get(), RenderTarget.Widget.ToSharedRef(), FVector2D(RenderTarget.Resolution),
+			DeltaTime);
+	}
+}
+
+bool FImGuiRenderTargetManager::CanRender() const
+{
+	return FApp::CanEverRender() && FSlateApplication::IsInitialized() && FSlateApplication::Get().GetRenderer();
+}
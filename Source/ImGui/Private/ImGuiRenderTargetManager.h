@@ -0,0 +1,93 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <Containers/Map.h>
+#include <Math/IntPoint.h>
+#include <Templates/SharedPointer.h>
+#include <UObject/NameTypes.h>
+#include <UObject/StrongObjectPtr.h>
+
+
+class FImGuiModuleManager;
+class FWidgetRenderer;
+class SImGuiDrawDataWidget;
+class UTextureRenderTarget2D;
+
+// Renders ImGui contexts to render targets, so their output can be shown on in-world surfaces or secondary displays.
+// Render targets are updated at a configurable rate and only when draw data of their contexts changed since the last
+// update.
+class FImGuiRenderTargetManager
+{
+public:
+
+	FImGuiRenderTargetManager(FImGuiModuleManager& InModuleManager);
+	~FImGuiRenderTargetManager();
+
+	FImGuiRenderTargetManager(const FImGuiRenderTargetManager&) = delete;
+	FImGuiRenderTargetManager& operator=(const FImGuiRenderTargetManager&) = delete;
+
+	FImGuiRenderTargetManager(FImGuiRenderTargetManager&&) = delete;
+	FImGuiRenderTargetManager& operator=(FImGuiRenderTargetManager&&) = delete;
+
+	// Create a render target showing output of the given context. If render target with that name already exists, it is
+	// retargeted and updated with the new settings.
+	// @param Name - Name identifying the render target
+	// @param ContextIndex - Index of the context to render
+	// @param Resolution - Resolution of the render target
+	// @param UpdateRate - Maximal number of updates per second or zero to allow updates in every frame
+	// @returns Render target to which context is rendered
+	UTextureRenderTarget2D* Add(const FName& Name, int32 ContextIndex, const FIntPoint& Resolution, float UpdateRate);
+
+	// Find a render target by name.
+	// @param Name - Name of the render target
+	// @returns Render target with given name or null, if there is no such render target
+	UTextureRenderTarget2D* Find(const FName& Name) const;
+
+	// Remove a render target and stop updating it.
+	// @param Name - Name of the render target
+	void Remove(const FName& Name);
+
+	// Change resolution of the render target. Content is rendered again in the next update.
+	// @param Name - Name of the render target
+	// @param Resolution - New resolution
+	void SetResolution(const FName& Name, const FIntPoint& Resolution);
+
+	// Change update rate of the render target.
+	// @param Name - Name of the render target
+	// @param UpdateRate - Maximal number of updates per second or zero to allow updates in every frame
+	void SetUpdateRate(const FName& Name, float UpdateRate);
+
+	// Update render targets. Should be called after contexts are ticked.
+	void Tick(float DeltaSeconds);
+
+private:
+
+	struct FRenderTarget
+	{
+		TStrongObjectPtr<UTextureRenderTarget2D> Texture;
+		TSharedPtr<SImGuiDrawDataWidget> Widget;
+
+		int32 ContextIndex = 0;
+		FIntPoint Resolution = FIntPoint::ZeroValue;
+
+		// Minimal time between updates.
+		float UpdateInterval = 0.f;
+		float TimeSinceUpdate = 0.f;
+
+		// Hash of the draw data from the last update.
+		uint64 DrawDataHash = 0;
+		bool bNeedsUpdate = true;
+	};
+
+	void UpdateRenderTarget(FRenderTarget& RenderTarget, float DeltaSeconds);
+
+	bool CanRender() const;
+
+	FImGuiModuleManager& ModuleManager;
+
+	TMap<FName, FRenderTarget> RenderTargets;
+
+	// Created on demand and released with deferred cleanup, as it may still be used by the rendering thread.
+	FWidgetRenderer* WidgetRenderer = nullptr;
+};
@@ -0,0 +1,1023 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiTextEditor.h"
+
+#include <imgui_internal.h>
+
+
+namespace
+{
+	// Maximal size of chunks created from new text.
+	constexpr int32 ChunkSize = 1024;
+
+	// Chunks can grow up to this size when text is inserted into them.
+	constexpr int32 MaxChunkSize = ChunkSize * 2;
+
+	// Maximal number of edits kept in the undo history.
+	constexpr int32 MaxUndoEdits = 256;
+
+	int32 CountLineBreaks(const ANSICHAR* Text, int32 Length)
+	{
+		int32 Count = 0;
+		for (int32 Index = 0; Index < Length; Index++)
+		{
+			Count += (Text[Index] == '\n');
+		}
+		return Count;
+	}
+
+	// Bytes of multi-byte UTF-8 characters are treated as word characters, so word boundaries are always at character
+	// boundaries.
+	bool IsWordChar(ANSICHAR Char)
+	{
+		return (Char & 0x80) != 0 || FCharAnsi::IsAlnum(Char) || Char == '_';
+	}
+
+	bool IsContinuationByte(ANSICHAR Char)
+	{
+		return (Char & 0xC0) == 0x80;
+	}
+
+	float GetTextWidth(const ImFont* Font, float FontSize, const char* Text, const char* TextEnd)
+	{
+		// Empty text is checked here, because ImGui treats null end as null-terminated text.
+		return Text != TextEnd ? Font->CalcTextSizeA(FontSize, FLT_MAX, 0.f, Text, TextEnd).x : 0.f;
+	}
+
+	// Same characters that multiline ImGui::InputText rejects. Line breaks and tabs come from keys.
+	bool IsInputChar(unsigned int Char)
+	{
+		return Char >= 0x20 && Char != 0x7F && !(Char >= 0xE000 && Char <= 0xF8FF);
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// FImGuiTextDocument
+//----------------------------------------------------------------------------------------------------
+
+FImGuiTextDocument::FImGuiTextDocument()
+{
+}
+
+void FImGuiTextDocument::SetText(const char* Text, int32 Length)
+{
+	if (Length < 0)
+	{
+		Length = Text ? FCStringAnsi::Strlen(Text) : 0;
+	}
+
+	Nodes.Reset();
+	FreeNodes.Reset();
+	Root = BuildChunks(Text, Length);
+	Version++;
+}
+
+void FImGuiTextDocument::GetText(TArray<ANSICHAR>& OutText) const
+{
+	GetRange(0, Len(), OutText);
+	OutText.Add('\0');
+}
+
+void FImGuiTextDocument::GetRange(int32 Offset, int32 Length, TArray<ANSICHAR>& OutText) const
+{
+	checkf(Offset >= 0 && Length >= 0 && Offset + Length <= Len(),
+		TEXT("Range [%d, %d) is outside of the document with length %d."), Offset, Offset + Length, Len());
+
+	OutText.Reset(Length);
+	CopyRange(Root, Offset, Offset + Length, OutText);
+}
+
+ANSICHAR FImGuiTextDocument::GetChar(int32 Offset) const
+{
+	checkf(Offset >= 0 && Offset < Len(), TEXT("Offset %d is outside of the document with length %d."), Offset, Len());
+
+	int32 Node = Root;
+	for (;;)
+	{
+		const FNode& Current = Nodes[Node];
+		const int32 LeftBytes = GetSubtreeBytes(Current.Left);
+		if (Offset < LeftBytes)
+		{
+			Node = Current.Left;
+			continue;
+		}
+
+		Offset -= LeftBytes;
+		if (Offset < Current.Text.Num())
+		{
+			return Current.Text[Offset];
+		}
+
+		Offset -= Current.Text.Num();
+		Node = Current.Right;
+	}
+}
+
+int32 FImGuiTextDocument::GetLineStart(int32 Line) const
+{
+	checkf(Line >= 0 && Line < NumLines(), TEXT("Line %d is outside of the document with %d lines."), Line, NumLines());
+	return Line > 0 ? FindLineBreak(Line - 1) + 1 : 0;
+}
+
+int32 FImGuiTextDocument::GetLineEnd(int32 Line) const
+{
+	checkf(Line >= 0 && Line < NumLines(), TEXT("Line %d is outside of the document with %d lines."), Line, NumLines());
+	return Line < NumLines() - 1 ? FindLineBreak(Line) : Len();
+}
+
+int32 FImGuiTextDocument::GetLineIndex(int32 Offset) const
+{
+	checkf(Offset >= 0 && Offset <= Len(), TEXT("Offset %d is outside of the document with length %d."), Offset, Len());
+
+	int32 Line = 0;
+	int32 Node = Root;
+	while (Node != INDEX_NONE)
+	{
+		const FNode& Current = Nodes[Node];
+		const int32 LeftBytes = GetSubtreeBytes(Current.Left);
+		if (Offset < LeftBytes)
+		{
+			Node = Current.Left;
+			continue;
+		}
+
+		Line += GetSubtreeLineBreaks(Current.Left);
+		Offset -= LeftBytes;
+		if (Offset <= Current.Text.Num())
+		{
+			return Line + CountLineBreaks(Current.Text.GetData(), Offset);
+		}
+
+		Line += Current.LineBreaks;
+		Offset -= Current.Text.Num();
+		Node = Current.Right;
+	}
+	return Line;
+}
+
+void FImGuiTextDocument::Insert(int32 Offset, const char* Text, int32 Length)
+{
+	checkf(Offset >= 0 && Offset <= Len(), TEXT("Offset %d is outside of the document with length %d."), Offset, Len());
+	checkf(Length >= 0, TEXT("Length cannot be negative (%d)."), Length);
+
+	if (Length == 0)
+	{
+		return;
+	}
+
+	Version++;
+
+	// Small insertions are usually absorbed by existing chunks, which doesn't change the shape of the tree.
+	if (Length <= MaxChunkSize && InsertIntoChunk(Root, Offset, Text, Length))
+	{
+		return;
+	}
+
+	int32 Left, Right;
+	Split(Root, Offset, Left, Right);
+	Root = Merge(Merge(Left, BuildChunks(Text, Length)), Right);
+}
+
+void FImGuiTextDocument::Remove(int32 Offset, int32 Length)
+{
+	checkf(Offset >= 0 && Length >= 0 && Offset + Length <= Len(),
+		TEXT("Range [%d, %d) is outside of the document with length %d."), Offset, Offset + Length, Len());
+
+	if (Length == 0)
+	{
+		return;
+	}
+
+	Version++;
+
+	if (RemoveFromChunk(Root, Offset, Length))
+	{
+		return;
+	}
+
+	int32 Left, Rest, Removed, Right;
+	Split(Root, Offset, Left, Rest);
+	Split(Rest, Length, Removed, Right);
+	FreeSubtree(Removed);
+	Root = Merge(Left, Right);
+}
+
+int32 FImGuiTextDocument::AllocateNode(const char* Text, int32 Length)
+{
+	const int32 Node = FreeNodes.Num() > 0 ? FreeNodes.Pop(false) : Nodes.AddDefaulted();
+
+	// Xorshift is enough to keep the tree balanced.
+	RandomState ^= RandomState << 13;
+	RandomState ^= RandomState >> 17;
+	RandomState ^= RandomState << 5;
+
+	FNode& NewNode = Nodes[Node];
+	NewNode.Text.Reset();
+	NewNode.Text.Append(Text, Length);
+	NewNode.Left = INDEX_NONE;
+	NewNode.Right = INDEX_NONE;
+	NewNode.Priority = RandomState;
+	NewNode.LineBreaks = CountLineBreaks(Text, Length);
+	UpdateNode(Node);
+	return Node;
+}
+
+void FImGuiTextDocument::FreeSubtree(int32 Node)
+{
+	if (Node != INDEX_NONE)
+	{
+		FreeSubtree(Nodes[Node].Left);
+		FreeSubtree(Nodes[Node].Right);
+		Nodes[Node].Text.Empty();
+		FreeNodes.Add(Node);
+	}
+}
+
+void FImGuiTextDocument::UpdateNode(int32 Node)
+{
+	FNode& Current = Nodes[Node];
+	Current.SubtreeBytes = GetSubtreeBytes(Current.Left) + Current.Text.Num() + GetSubtreeBytes(Current.Right);
+	Current.SubtreeLineBreaks = GetSubtreeLineBreaks(Current.Left) + Current.LineBreaks + GetSubtreeLineBreaks(Current.Right);
+}
+
+int32 FImGuiTextDocument::Merge(int32 Left, int32 Right)
+{
+	if (Left == INDEX_NONE)
+	{
+		return Right;
+	}
+	if (Right == INDEX_NONE)
+	{
+		return Left;
+	}
+
+	if (Nodes[Left].Priority > Nodes[Right].Priority)
+	{
+		const int32 Merged = Merge(Nodes[Left].Right, Right);
+		Nodes[Left].Right = Merged;
+		UpdateNode(Left);
+		return Left;
+	}
+	else
+	{
+		const int32 Merged = Merge(Left, Nodes[Right].Left);
+		Nodes[Right].Left = Merged;
+		UpdateNode(Right);
+		return Right;
+	}
+}
+
+void FImGuiTextDocument::Split(int32 Node, int32 Offset, int32& OutLeft, int32& OutRight)
+{
+	if (Node == INDEX_NONE)
+	{
+		OutLeft = OutRight = INDEX_NONE;
+		return;
+	}
+
+	const int32 LeftBytes = GetSubtreeBytes(Nodes[Node].Left);
+	const int32 NodeBytes = Nodes[Node].Text.Num();
+
+	if (Offset <= LeftBytes)
+	{
+		int32 SplitRight;
+		Split(Nodes[Node].Left, Offset, OutLeft, SplitRight);
+		Nodes[Node].Left = SplitRight;
+		UpdateNode(Node);
+		OutRight = Node;
+	}
+	else if (Offset >= LeftBytes + NodeBytes)
+	{
+		int32 SplitLeft;
+		Split(Nodes[Node].Right, Offset - LeftBytes - NodeBytes, SplitLeft, OutRight);
+		Nodes[Node].Right = SplitLeft;
+		UpdateNode(Node);
+		OutLeft = Node;
+	}
+	else
+	{
+		// Offset is inside of this chunk, so cut it and move the tail to a new node. The tail gets a lower priority, so
+		// the right part can take the place of this node in the parent without breaking the heap order.
+		const int32 Cut = Offset - LeftBytes;
+		const int32 Tail = AllocateNode(nullptr, 0);
+
+		FNode& Current = Nodes[Node];
+		FNode& TailNode = Nodes[Tail];
+		TailNode.Text.Append(Current.Text.GetData() + Cut, NodeBytes - Cut);
+		TailNode.LineBreaks = CountLineBreaks(TailNode.Text.GetData(), TailNode.Text.Num());
+		TailNode.Priority = Current.Priority > 0 ? TailNode.Priority % Current.Priority : 0;
+		UpdateNode(Tail);
+
+		Current.Text.SetNum(Cut, false);
+		Current.LineBreaks -= TailNode.LineBreaks;
+
+		const int32 OldRight = Current.Right;
+		Current.Right = INDEX_NONE;
+		UpdateNode(Node);
+
+		OutLeft = Node;
+		OutRight = Merge(Tail, OldRight);
+	}
+}
+
+int32 FImGuiTextDocument::BuildChunks(const char* Text, int32 Length)
+{
+	int32 Result = INDEX_NONE;
+	for (int32 Offset = 0; Offset < Length; Offset += ChunkSize)
+	{
+		const int32 Chunk = AllocateNode(Text + Offset, FMath::Min(ChunkSize, Length - Offset));
+		Result = Merge(Result, Chunk);
+	}
+	return Result;
+}
+
+bool FImGuiTextDocument::InsertIntoChunk(int32 Node, int32 Offset, const char* Text, int32 Length)
+{
+	if (Node == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Nothing is allocated here, so the reference stays valid.
+	FNode& Current = Nodes[Node];
+	const int32 LocalOffset = Offset - GetSubtreeBytes(Current.Left);
+
+	bool bInserted = false;
+	if (LocalOffset <= 0)
+	{
+		bInserted = InsertIntoChunk(Current.Left, Offset, Text, Length);
+	}
+	if (!bInserted && LocalOffset >= 0 && LocalOffset <= Current.Text.Num() && Current.Text.Num() + Length <= MaxChunkSize)
+	{
+		Current.Text.Insert(Text, Length, LocalOffset);
+		Current.LineBreaks += CountLineBreaks(Text, Length);
+		bInserted = true;
+	}
+	if (!bInserted && LocalOffset >= Current.Text.Num())
+	{
+		bInserted = InsertIntoChunk(Current.Right, LocalOffset - Current.Text.Num(), Text, Length);
+	}
+
+	if (bInserted)
+	{
+		UpdateNode(Node);
+	}
+	return bInserted;
+}
+
+bool FImGuiTextDocument::RemoveFromChunk(int32 Node, int32 Offset, int32 Length)
+{
+	if (Node == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Nothing is allocated here, so the reference stays valid.
+	FNode& Current = Nodes[Node];
+	const int32 LocalOffset = Offset - GetSubtreeBytes(Current.Left);
+
+	bool bRemoved = false;
+	if (LocalOffset < 0)
+	{
+		bRemoved = RemoveFromChunk(Current.Left, Offset, Length);
+	}
+	else if (LocalOffset >= Current.Text.Num())
+	{
+		bRemoved = RemoveFromChunk(Current.Right, LocalOffset - Current.Text.Num(), Length);
+	}
+	else if (LocalOffset + Length <= Current.Text.Num() && Length < Current.Text.Num())
+	{
+		// Range is inside of this chunk and doesn't cover all of it (empty chunks are removed from the tree).
+		Current.LineBreaks -= CountLineBreaks(Current.Text.GetData() + LocalOffset, Length);
+		Current.Text.RemoveAt(LocalOffset, Length, false);
+		bRemoved = true;
+	}
+
+	if (bRemoved)
+	{
+		UpdateNode(Node);
+	}
+	return bRemoved;
+}
+
+void FImGuiTextDocument::CopyRange(int32 Node, int32 Begin, int32 End, TArray<ANSICHAR>& OutText) const
+{
+	if (Node == INDEX_NONE || Begin >= End)
+	{
+		return;
+	}
+
+	const FNode& Current = Nodes[Node];
+	const int32 LeftBytes = GetSubtreeBytes(Current.Left);
+	if (Begin < LeftBytes)
+	{
+		CopyRange(Current.Left, Begin, FMath::Min(End, LeftBytes), OutText);
+	}
+
+	const int32 ChunkBegin = FMath::Max(Begin - LeftBytes, 0);
+	const int32 ChunkEnd = FMath::Min(End - LeftBytes, Current.Text.Num());
+	if (ChunkBegin < ChunkEnd)
+	{
+		OutText.Append(Current.Text.GetData() + ChunkBegin, ChunkEnd - ChunkBegin);
+	}
+
+	const int32 RightBase = LeftBytes + Current.Text.Num();
+	if (End > RightBase)
+	{
+		CopyRange(Current.Right, FMath::Max(Begin - RightBase, 0), End - RightBase, OutText);
+	}
+}
+
+int32 FImGuiTextDocument::FindLineBreak(int32 Index) const
+{
+	int32 Node = Root;
+	int32 Base = 0;
+	for (;;)
+	{
+		const FNode& Current = Nodes[Node];
+		const int32 LeftLineBreaks = GetSubtreeLineBreaks(Current.Left);
+		if (Index < LeftLineBreaks)
+		{
+			Node = Current.Left;
+			continue;
+		}
+
+		Index -= LeftLineBreaks;
+		Base += GetSubtreeBytes(Current.Left);
+		if (Index < Current.LineBreaks)
+		{
+			for (int32 Position = 0;; Position++)
+			{
+				if (Current.Text[Position] == '\n' && Index-- == 0)
+				{
+					return Base + Position;
+				}
+			}
+		}
+
+		Index -= Current.LineBreaks;
+		Base += Current.Text.Num();
+		Node = Current.Right;
+	}
+}
+
+//----------------------------------------------------------------------------------------------------
+// FImGuiTextEditor
+//----------------------------------------------------------------------------------------------------
+
+void FImGuiTextEditor::SetText(const char* Text, int32 Length)
+{
+	Document.SetText(Text, Length);
+	DocumentVersion = Document.GetVersion();
+	Cursor = SelectionAnchor = 0;
+	PreferredX = -1.f;
+	MaxLineWidth = 0.f;
+	bScrollToCursor = true;
+	bMouseSelecting = false;
+	UndoStack.Reset();
+	UndoIndex = 0;
+}
+
+void FImGuiTextEditor::SetCursor(int32 Offset)
+{
+	MoveCursor(FMath::Clamp(Offset, 0, Document.Len()), false);
+	PreferredX = -1.f;
+}
+
+bool FImGuiTextEditor::Draw(const char* Label, const ImVec2& Size)
+{
+	ImGuiContext& Context = *GImGui;
+	ImGuiIO& IO = Context.IO;
+
+	if (ImGui::GetCurrentWindow()->SkipItems)
+	{
+		return false;
+	}
+
+	// If the document was modified outside of the editor, offsets in the undo history are no longer valid.
+	if (Document.GetVersion() != DocumentVersion)
+	{
+		DocumentVersion = Document.GetVersion();
+		Cursor = FMath::Min(Cursor, Document.Len());
+		SelectionAnchor = FMath::Min(SelectionAnchor, Document.Len());
+		UndoStack.Reset();
+		UndoIndex = 0;
+	}
+	const uint32 InitialVersion = DocumentVersion;
+
+	const ImGuiID Id = ImGui::GetID(Label);
+	const float LineHeight = Context.FontSize;
+	const ImVec2 FrameSize = ImGui::CalcItemSize(Size, ImGui::CalcItemWidth(), LineHeight * 8.f + Context.Style.FramePadding.y * 2.f);
+
+	const ImGuiWindowFlags WindowFlags = ImGuiWindowFlags_HorizontalScrollbar | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoNavInputs;
+	if (!ImGui::BeginChildEx(Label, Id, FrameSize, ImGuiChildFlags_FrameStyle, WindowFlags))
+	{
+		ImGui::EndChild();
+		return false;
+	}
+
+	ImGuiWindow* Window = ImGui::GetCurrentWindow();
+	const ImVec2 Origin = Window->DC.CursorPos;
+	const ImRect& ViewRect = Window->InnerClipRect;
+
+	ImGui::ItemAdd(ViewRect, Id, nullptr, ImGuiItemFlags_Inputable);
+	const bool bHovered = ImGui::ItemHoverable(ViewRect, Id, Context.LastItemData.InFlags);
+	if (bHovered)
+	{
+		ImGui::SetMouseCursor(ImGuiMouseCursor_TextInput);
+	}
+
+	const auto GetOffsetAtMouse = [&]()
+	{
+		const int32 Line = FMath::Clamp(FMath::FloorToInt((IO.MousePos.y - Origin.y) / LineHeight), 0, Document.NumLines() - 1);
+		return GetLineOffsetAtX(Line, IO.MousePos.x - Origin.x);
+	};
+
+	// Mouse input.
+	if (bHovered && IO.MouseClicked[0])
+	{
+		if (Context.ActiveId != Id)
+		{
+			ImGui::SetActiveID(Id, Window);
+			ImGui::SetFocusID(Id, Window);
+			ImGui::FocusWindow(Window);
+		}
+		ImGui::SetKeyOwner(ImGuiKey_MouseLeft, Id);
+
+		MoveCursor(GetOffsetAtMouse(), IO.KeyShift);
+		PreferredX = -1.f;
+		bMouseSelecting = true;
+
+		// Double-click selects a word.
+		if (IO.MouseClickedCount[0] == 2)
+		{
+			SelectionAnchor = Cursor;
+			while (SelectionAnchor > 0 && IsWordChar(Document.GetChar(SelectionAnchor - 1)))
+			{
+				SelectionAnchor--;
+			}
+			while (Cursor < Document.Len() && IsWordChar(Document.GetChar(Cursor)))
+			{
+				Cursor++;
+			}
+		}
+	}
+	else if (Context.ActiveId == Id && IO.MouseClicked[0])
+	{
+		// Release focus when clicking outside.
+		ImGui::ClearActiveID();
+	}
+
+	const bool bActive = (Context.ActiveId == Id);
+
+	if (bMouseSelecting)
+	{
+		if (bActive && IO.MouseDown[0])
+		{
+			if (IO.MouseDelta.x != 0.f || IO.MouseDelta.y != 0.f)
+			{
+				MoveCursor(GetOffsetAtMouse(), true);
+			}
+		}
+		else
+		{
+			bMouseSelecting = false;
+		}
+	}
+
+	// Keyboard input.
+	if (bActive && !Context.ActiveIdIsJustActivated)
+	{
+		Context.ActiveIdUsingNavDirMask |= (1 << ImGuiDir_Left) | (1 << ImGuiDir_Right) | (1 << ImGuiDir_Up) | (1 << ImGuiDir_Down);
+		ImGui::SetKeyOwner(ImGuiKey_Enter, Id);
+		ImGui::SetKeyOwner(ImGuiKey_KeypadEnter, Id);
+		ImGui::SetKeyOwner(ImGuiKey_Home, Id);
+		ImGui::SetKeyOwner(ImGuiKey_End, Id);
+		ImGui::SetKeyOwner(ImGuiKey_PageUp, Id);
+		ImGui::SetKeyOwner(ImGuiKey_PageDown, Id);
+		Context.WantTextInputNextFrame = 1;
+
+		const ImGuiInputFlags Repeat = ImGuiInputFlags_Repeat;
+		const bool bSelect = IO.KeyShift;
+		const bool bWordMove = IO.ConfigMacOSXBehaviors ? IO.KeyAlt : IO.KeyCtrl;
+		const bool bDocumentMove = IO.ConfigMacOSXBehaviors ? IO.KeySuper : IO.KeyCtrl;
+
+		const bool bTab = ImGui::Shortcut(ImGuiKey_Tab, Id, Repeat);
+		const bool bCut = ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_X, Id, Repeat) || ImGui::Shortcut(ImGuiMod_Shift | ImGuiKey_Delete, Id, Repeat);
+		const bool bCopy = ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_C, Id) || ImGui::Shortcut(ImGuiMod_Ctrl | ImGuiKey_Insert, Id);
+		const bool bPaste = ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_V, Id, Repeat) || ImGui::Shortcut(ImGuiMod_Shift | ImGuiKey_Insert, Id, Repeat);
+		const bool bUndo = ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_Z, Id, Repeat);
+		const bool bRedo = ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_Y, Id, Repeat) || ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiMod_Shift | ImGuiKey_Z, Id, Repeat);
+		const bool bSelectAll = ImGui::Shortcut(ImGuiMod_Shortcut | ImGuiKey_A, Id);
+		const bool bEscape = ImGui::Shortcut(ImGuiKey_Escape, Id);
+
+		// Text input. Control characters other than tabs and line breaks are ignored. We ignore CTRL inputs, but allow
+		// ALT+CTRL, which is used as AltGR on some keyboards.
+		const bool bIgnoreChars = (IO.KeyCtrl && !IO.KeyAlt) || (IO.ConfigMacOSXBehaviors && IO.KeySuper);
+		if (!bReadOnly && !bIgnoreChars)
+		{
+			for (int32 Index = 0; Index < IO.InputQueueCharacters.Size; Index++)
+			{
+				const unsigned int Char = IO.InputQueueCharacters[Index];
+				if (IsInputChar(Char))
+				{
+					char Utf8[5];
+					ImTextCharToUtf8(Utf8, Char);
+					Replace(GetSelectionStart(), GetSelectionEnd(), Utf8, FCStringAnsi::Strlen(Utf8), true);
+				}
+			}
+		}
+		IO.InputQueueCharacters.resize(0);
+
+		if (bTab && !bReadOnly)
+		{
+			Replace(GetSelectionStart(), GetSelectionEnd(), "\t", 1, true);
+		}
+
+		const int32 PageLines = FMath::Max(FMath::FloorToInt(ViewRect.GetHeight() / LineHeight), 1);
+		int32 LineDelta = 0;
+
+		if (ImGui::IsKeyPressed(ImGuiKey_LeftArrow))
+		{
+			const int32 Offset = (HasSelection() && !bSelect) ? GetSelectionStart() : bWordMove ? GetPreviousWord(Cursor) : GetPreviousChar(Cursor);
+			MoveCursor(Offset, bSelect);
+			PreferredX = -1.f;
+		}
+		else if (ImGui::IsKeyPressed(ImGuiKey_RightArrow))
+		{
+			const int32 Offset = (HasSelection() && !bSelect) ? GetSelectionEnd() : bWordMove ? GetNextWord(Cursor) : GetNextChar(Cursor);
+			MoveCursor(Offset, bSelect);
+			PreferredX = -1.f;
+		}
+		else if (ImGui::IsKeyPressed(ImGuiKey_UpArrow))
+		{
+			LineDelta = -1;
+		}
+		else if (ImGui::IsKeyPressed(ImGuiKey_DownArrow))
+		{
+			LineDelta = 1;
+		}
+		else if (ImGui::IsKeyPressed(ImGuiKey_PageUp))
+		{
+			LineDelta = -PageLines;
+			ImGui::SetScrollY(Window->Scroll.y - PageLines * LineHeight);
+		}
+		else if (ImGui::IsKeyPressed(ImGuiKey_PageDown))
+		{
+			LineDelta = PageLines;
+			ImGui::SetScrollY(Window->Scroll.y + PageLines * LineHeight);
+		}
+		else if (ImGui::IsKeyPressed(ImGuiKey_Home))
+		{
+			MoveCursor(bDocumentMove ? 0 : Document.GetLineStart(Document.GetLineIndex(Cursor)), bSelect);
+			PreferredX = -1.f;
+		}
+		else if (ImGui::IsKeyPressed(ImGuiKey_End))
+		{
+			MoveCursor(bDocumentMove ? Document.Len() : Document.GetLineEnd(Document.GetLineIndex(Cursor)), bSelect);
+			PreferredX = -1.f;
+		}
+		else if (ImGui::IsKeyPressed(ImGuiKey_Delete) && !bReadOnly && !bCut)
+		{
+			if (HasSelection())
+			{
+				Replace(GetSelectionStart(), GetSelectionEnd(), nullptr, 0);
+			}
+			else if (Cursor < Document.Len())
+			{
+				Replace(Cursor, bWordMove ? GetNextWord(Cursor) : GetNextChar(Cursor), nullptr, 0);
+			}
+		}
+		else if (ImGui::IsKeyPressed(ImGuiKey_Backspace) && !bReadOnly)
+		{
+			if (HasSelection())
+			{
+				Replace(GetSelectionStart(), GetSelectionEnd(), nullptr, 0);
+			}
+			else if (Cursor > 0)
+			{
+				Replace(bWordMove ? GetPreviousWord(Cursor) : GetPreviousChar(Cursor), Cursor, nullptr, 0);
+			}
+		}
+		else if ((ImGui::IsKeyPressed(ImGuiKey_Enter) || ImGui::IsKeyPressed(ImGuiKey_KeypadEnter)) && !bReadOnly)
+		{
+			Replace(GetSelectionStart(), GetSelectionEnd(), "\n", 1);
+		}
+		else if (bSelectAll)
+		{
+			SelectionAnchor = 0;
+			Cursor = Document.Len();
+		}
+		else if ((bCut || bCopy) && HasSelection())
+		{
+			TArray<ANSICHAR> Clipboard;
+			Document.GetRange(GetSelectionStart(), GetSelectionEnd() - GetSelectionStart(), Clipboard);
+			Clipboard.Add('\0');
+			ImGui::SetClipboardText(Clipboard.GetData());
+			if (bCut && !bReadOnly)
+			{
+				Replace(GetSelectionStart(), GetSelectionEnd(), nullptr, 0);
+			}
+		}
+		else if (bPaste && !bReadOnly)
+		{
+			if (const char* ClipboardText = ImGui::GetClipboardText())
+			{
+				TArray<ANSICHAR> Pasted;
+				for (const char* Char = ClipboardText; *Char; Char++)
+				{
+					if (*Char != '\r')
+					{
+						Pasted.Add(*Char);
+					}
+				}
+				Replace(GetSelectionStart(), GetSelectionEnd(), Pasted.GetData(), Pasted.Num());
+			}
+		}
+		else if ((bUndo || bRedo) && !bReadOnly)
+		{
+			ApplyUndo(bRedo);
+		}
+		else if (bEscape)
+		{
+			ImGui::ClearActiveID();
+		}
+
+		if (LineDelta != 0)
+		{
+			const int32 Line = Document.GetLineIndex(Cursor);
+			if (PreferredX < 0.f)
+			{
+				PreferredX = GetLineX(Line, Cursor);
+			}
+			const int32 TargetLine = FMath::Clamp(Line + LineDelta, 0, Document.NumLines() - 1);
+			MoveCursor(GetLineOffsetAtX(TargetLine, PreferredX), bSelect);
+
+			// Page moves scroll the view together with the cursor, keeping it at the same position in the view.
+			if (FMath::Abs(LineDelta) > 1)
+			{
+				bScrollToCursor = false;
+			}
+		}
+	}
+
+	const int32 NumLines = Document.NumLines();
+
+	// Keep the cursor in view. Scrolling is applied in the next frame.
+	if (bScrollToCursor)
+	{
+		bScrollToCursor = false;
+
+		const int32 CursorLine = Document.GetLineIndex(Cursor);
+		const float CursorX = Origin.x + GetLineX(CursorLine, Cursor);
+		const float CursorY = Origin.y + CursorLine * LineHeight;
+		MaxLineWidth = FMath::Max(MaxLineWidth, CursorX - Origin.x);
+
+		if (CursorY < ViewRect.Min.y)
+		{
+			ImGui::SetScrollY(Window->Scroll.y - (ViewRect.Min.y - CursorY));
+		}
+		else if (CursorY + LineHeight > ViewRect.Max.y)
+		{
+			ImGui::SetScrollY(Window->Scroll.y + (CursorY + LineHeight - ViewRect.Max.y));
+		}
+
+		if (CursorX < ViewRect.Min.x)
+		{
+			ImGui::SetScrollX(Window->Scroll.x - (ViewRect.Min.x - CursorX));
+		}
+		else if (CursorX + 1.f > ViewRect.Max.x)
+		{
+			ImGui::SetScrollX(Window->Scroll.x + (CursorX + 1.f - ViewRect.Max.x));
+		}
+	}
+
+	// Draw only visible lines. They are copied from the document in one go and split here.
+	const int32 FirstLine = FMath::Clamp(FMath::FloorToInt((ViewRect.Min.y - Origin.y) / LineHeight), 0, NumLines - 1);
+	const int32 LastLine = FMath::Clamp(FMath::FloorToInt((ViewRect.Max.y - Origin.y) / LineHeight), FirstLine, NumLines - 1);
+	const int32 VisibleStart = Document.GetLineStart(FirstLine);
+	Document.GetRange(VisibleStart, Document.GetLineEnd(LastLine) - VisibleStart, LineBuffer);
+
+	ImDrawList* DrawList = Window->DrawList;
+	ImFont* Font = Context.Font;
+	const float FontSize = Context.FontSize;
+	const float SpaceWidth = Font->GetCharAdvance(' ') * (FontSize / Font->FontSize);
+	const ImU32 TextColor = ImGui::GetColorU32(ImGuiCol_Text);
+	const ImU32 SelectionColor = ImGui::GetColorU32(ImGuiCol_TextSelectedBg);
+	const bool bCursorVisible = bActive && (!IO.ConfigInputTextCursorBlink || ImFmod((float)(ImGui::GetTime() - CursorBlinkStart), 1.2f) <= 0.8f);
+
+	const int32 SelectionStart = GetSelectionStart();
+	const int32 SelectionEnd = GetSelectionEnd();
+
+	const char* VisibleText = LineBuffer.GetData();
+	const char* VisibleTextEnd = VisibleText + LineBuffer.Num();
+	const char* LineText = VisibleText;
+
+	for (int32 Line = FirstLine; Line <= LastLine; Line++)
+	{
+		const char* LineTextEnd = LineText;
+		while (LineTextEnd < VisibleTextEnd && *LineTextEnd != '\n')
+		{
+			LineTextEnd++;
+		}
+
+		const int32 LineStart = VisibleStart + (int32)(LineText - VisibleText);
+		const int32 LineEnd = VisibleStart + (int32)(LineTextEnd - VisibleText);
+		const ImVec2 LinePos(Origin.x, Origin.y + Line * LineHeight);
+
+		const auto GetX = [&](int32 Offset)
+		{
+			return GetTextWidth(Font, FontSize, LineText, LineText + (Offset - LineStart));
+		};
+
+		const float LineWidth = GetX(LineEnd);
+		MaxLineWidth = FMath::Max(MaxLineWidth, LineWidth);
+
+		// Selection includes the line break, which is marked with a space-wide rectangle.
+		if (SelectionStart < SelectionEnd && SelectionStart <= LineEnd && SelectionEnd > LineStart)
+		{
+			const float SelectionMinX = SelectionStart > LineStart ? GetX(SelectionStart) : 0.f;
+			const float SelectionMaxX = SelectionEnd <= LineEnd ? GetX(SelectionEnd) : LineWidth + SpaceWidth;
+			DrawList->AddRectFilled(ImVec2(LinePos.x + SelectionMinX, LinePos.y), ImVec2(LinePos.x + SelectionMaxX, LinePos.y + LineHeight), SelectionColor);
+		}
+
+		if (LineText != LineTextEnd)
+		{
+			DrawList->AddText(Font, FontSize, LinePos, TextColor, LineText, LineTextEnd);
+		}
+
+		if (bActive && Cursor >= LineStart && Cursor <= LineEnd)
+		{
+			const ImVec2 CursorPos(LinePos.x + GetX(Cursor), LinePos.y);
+			if (bCursorVisible)
+			{
+				DrawList->AddLine(ImVec2(CursorPos.x, CursorPos.y + 0.5f), ImVec2(CursorPos.x, CursorPos.y + LineHeight - 1.5f), TextColor);
+			}
+
+			Context.PlatformImeData.WantVisible = true;
+			Context.PlatformImeData.InputPos = ImVec2(CursorPos.x - 1.f, CursorPos.y - FontSize);
+			Context.PlatformImeData.InputLineHeight = FontSize;
+		}
+
+		LineText = LineTextEnd + 1;
+	}
+
+	// Reserve space for all lines, so scrolling works as if the whole document was laid out.
+	ImGui::SetCursorScreenPos(Origin);
+	ImGui::Dummy(ImVec2(MaxLineWidth + 1.f, NumLines * LineHeight));
+
+	ImGui::EndChild();
+
+	return DocumentVersion != InitialVersion;
+}
+
+void FImGuiTextEditor::Replace(int32 Start, int32 End, const char* Text, int32 Length, bool bTyping)
+{
+	FEdit Edit;
+	Edit.Offset = Start;
+	Document.GetRange(Start, End - Start, Edit.Removed);
+	Edit.Inserted.Append(Text, Length);
+	Edit.bTyping = bTyping;
+
+	Document.Remove(Start, End - Start);
+	Document.Insert(Start, Text, Length);
+	DocumentVersion = Document.GetVersion();
+
+	// New edit discards edits that could be redone. Consecutive typing is merged into one edit.
+	UndoStack.SetNum(UndoIndex, false);
+	FEdit* LastEdit = UndoStack.Num() > 0 ? &UndoStack.Last() : nullptr;
+	if (bTyping && LastEdit && LastEdit->bTyping && Edit.Removed.Num() == 0 && LastEdit->Offset + LastEdit->Inserted.Num() == Start)
+	{
+		LastEdit->Inserted.Append(Text, Length);
+	}
+	else
+	{
+		if (UndoStack.Num() >= MaxUndoEdits)
+		{
+			UndoStack.RemoveAt(0);
+		}
+		UndoStack.Add(MoveTemp(Edit));
+	}
+	UndoIndex = UndoStack.Num();
+
+	MoveCursor(Start + Length, false);
+	PreferredX = -1.f;
+}
+
+void FImGuiTextEditor::ApplyUndo(bool bRedo)
+{
+	if (bRedo ? UndoIndex >= UndoStack.Num() : UndoIndex <= 0)
+	{
+		return;
+	}
+
+	const FEdit& Edit = bRedo ? UndoStack[UndoIndex++] : UndoStack[--UndoIndex];
+	const TArray<ANSICHAR>& From = bRedo ? Edit.Removed : Edit.Inserted;
+	const TArray<ANSICHAR>& To = bRedo ? Edit.Inserted : Edit.Removed;
+
+	Document.Remove(Edit.Offset, From.Num());
+	Document.Insert(Edit.Offset, To.GetData(), To.Num());
+	DocumentVersion = Document.GetVersion();
+
+	MoveCursor(Edit.Offset + To.Num(), false);
+	PreferredX = -1.f;
+}
+
+void FImGuiTextEditor::MoveCursor(int32 Offset, bool bSelect)
+{
+	Cursor = Offset;
+	if (!bSelect)
+	{
+		SelectionAnchor = Offset;
+	}
+	bScrollToCursor = true;
+	CursorBlinkStart = ImGui::GetTime();
+}
+
+int32 FImGuiTextEditor::GetPreviousChar(int32 Offset) const
+{
+	if (Offset > 0)
+	{
+		Offset--;
+		while (Offset > 0 && IsContinuationByte(Document.GetChar(Offset)))
+		{
+			Offset--;
+		}
+	}
+	return Offset;
+}
+
+int32 FImGuiTextEditor::GetNextChar(int32 Offset) const
+{
+	const int32 Length = Document.Len();
+	if (Offset < Length)
+	{
+		Offset++;
+		while (Offset < Length && IsContinuationByte(Document.GetChar(Offset)))
+		{
+			Offset++;
+		}
+	}
+	return Offset;
+}
+
+int32 FImGuiTextEditor::GetPreviousWord(int32 Offset) const
+{
+	while (Offset > 0 && !IsWordChar(Document.GetChar(Offset - 1)))
+	{
+		Offset--;
+	}
+	while (Offset > 0 && IsWordChar(Document.GetChar(Offset - 1)))
+	{
+		Offset--;
+	}
+	return Offset;
+}
+
+int32 FImGuiTextEditor::GetNextWord(int32 Offset) const
+{
+	const int32 Length = Document.Len();
+	while (Offset < Length && IsWordChar(Document.GetChar(Offset)))
+	{
+		Offset++;
+	}
+	while (Offset < Length && !IsWordChar(Document.GetChar(Offset)))
+	{
+		Offset++;
+	}
+	return Offset;
+}
+
+float FImGuiTextEditor::GetLineX(int32 Line, int32 Offset) const
+{
+	const int32 LineStart = Document.GetLineStart(Line);
+	Document.GetRange(LineStart, Offset - LineStart, LineBuffer);
+	return GetTextWidth(ImGui::GetFont(), ImGui::GetFontSize(), LineBuffer.GetData(), LineBuffer.GetData() + LineBuffer.Num());
+}
+
+int32 FImGuiTextEditor::GetLineOffsetAtX(int32 Line, float X) const
+{
+	const int32 LineStart = Document.GetLineStart(Line);
+	Document.GetRange(LineStart, Document.GetLineEnd(Line) - LineStart, LineBuffer);
+
+	const ImFont* Font = ImGui::GetFont();
+	const float Scale = ImGui::GetFontSize() / Font->FontSize;
+
+	const char* Text = LineBuffer.GetData();
+	const char* TextEnd = Text + LineBuffer.Num();
+	const char* Position = Text;
+	float PositionX = 0.f;
+	while (Position < TextEnd)
+	{
+		unsigned int Char;
+		const int32 CharLength = ImTextCharFromUtf8(&Char, Position, TextEnd);
+		const float Advance = Font->GetCharAdvance((ImWchar)Char) * Scale;
+		if (X < PositionX + Advance * 0.5f)
+		{
+			break;
+		}
+		PositionX += Advance;
+		Position += CharLength;
+	}
+	return LineStart + (int32)(Position - Text);
+}
@@ -0,0 +1,240 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiTextFilterView.h"
+
+#include <Algo/BinarySearch.h>
+#include <Async/Async.h>
+
+#include <atomic>
+
+
+namespace
+{
+	// Sources with fewer items to scan are filtered on the calling thread.
+	constexpr int32 SynchronousBuildLimit = 4096;
+
+	// Number of items scanned between checks for cancellation.
+	constexpr int32 CancellationCheckInterval = 4096;
+
+	// Check whether every item that passes the New filter also passes the Old one, so the result of the Old filter can
+	// be refined. That is the case when New only appends characters to the last term of Old and that term is a
+	// non-empty include term (adding a new term or extending an exclude term widens the result).
+	bool IsNarrowing(const char* Old, const char* New)
+	{
+		const int32 OldLength = FCStringAnsi::Strlen(Old);
+		if (FCStringAnsi::Strncmp(Old, New, OldLength) != 0 || FCStringAnsi::Strchr(New + OldLength, ','))
+		{
+			return false;
+		}
+
+		const char* LastTerm = FCStringAnsi::Strrchr(Old, ',');
+		LastTerm = LastTerm ? LastTerm + 1 : Old;
+		while (*LastTerm == ' ' || *LastTerm == '\t')
+		{
+			LastTerm++;
+		}
+
+		return *LastTerm != '\0' && *LastTerm != '-';
+	}
+}
+
+struct FImGuiTextFilterView::FBuild
+{
+	// Filter is constructed and destroyed on the owning thread, because ImGui allocations are not thread-safe.
+	FBuild(const char* Text, int32 InItemCount, uint32 InSourceVersion)
+		: Filter(Text)
+		, ItemCount(InItemCount)
+		, SourceVersion(InSourceVersion)
+	{
+	}
+
+	// Scan candidates (if refining) or all items and write those that pass the filter to the result.
+	void Run(const FGetItemName& GetItemName)
+	{
+		const int32 Count = bRefine ? Candidates.Num() : ItemCount;
+		Result.Reserve(Count);
+		for (int32 I = 0; I < Count; I++)
+		{
+			if (I % CancellationCheckInterval == 0 && bCancelled.load(std::memory_order_relaxed))
+			{
+				return;
+			}
+
+			const int32 Index = bRefine ? Candidates[I] : I;
+			if (Filter.PassFilter(GetItemName(Index)))
+			{
+				Result.Add(Index);
+			}
+		}
+		Result.Shrink();
+	}
+
+	bool IsFinished() const { return !Task.IsValid() || Task.IsReady(); }
+
+	ImGuiTextFilter Filter;
+	int32 ItemCount;
+	uint32 SourceVersion;
+
+	// If set, only candidates are scanned.
+	bool bRefine = false;
+	TArray<int32> Candidates;
+
+	TArray<int32> Result;
+	std::atomic<bool> bCancelled{ false };
+	TFuture<void> Task;
+};
+
+bool FImGuiTextFilterView::FQuery::Equals(const char* InText, int32 InItemCount, uint32 InSourceVersion) const
+{
+	return bValid && ItemCount == InItemCount && SourceVersion == InSourceVersion
+		&& FCStringAnsi::Strcmp(Text.GetData(), InText) == 0;
+}
+
+void FImGuiTextFilterView::FQuery::Set(const char* InText, int32 InItemCount, uint32 InSourceVersion)
+{
+	Text.Reset();
+	Text.Append(InText, FCStringAnsi::Strlen(InText) + 1);
+	ItemCount = InItemCount;
+	SourceVersion = InSourceVersion;
+	bValid = true;
+}
+
+FImGuiTextFilterView::FImGuiTextFilterView(FGetItemName InGetItemName)
+	: GetItemName(MoveTemp(InGetItemName))
+{
+	checkf(GetItemName, TEXT("Filter view requires a function returning item names."));
+}
+
+FImGuiTextFilterView::~FImGuiTextFilterView()
+{
+	Cancel();
+}
+
+bool FImGuiTextFilterView::Update(const ImGuiTextFilter& Filter, int32 ItemCount, uint32 SourceVersion)
+{
+	checkf(ItemCount >= 0, TEXT("Item count cannot be negative (%d)."), ItemCount);
+
+	ReleaseRetiredBuilds(false);
+
+	bool bChanged = false;
+
+	if (!RequestedQuery.Equals(Filter.InputBuf, ItemCount, SourceVersion))
+	{
+		RequestedQuery.Set(Filter.InputBuf, ItemCount, SourceVersion);
+
+		// Make sure that indices are valid for the new source, even before they are rebuilt.
+		if (IndicesQuery.bValid && ItemCount < IndicesQuery.ItemCount)
+		{
+			const int32 ValidNum = Algo::LowerBound(Indices, ItemCount);
+			if (ValidNum < Indices.Num())
+			{
+				Indices.SetNum(ValidNum, false);
+				bChanged = true;
+			}
+		}
+
+		StartBuild(Filter, ItemCount, SourceVersion);
+		bChanged |= !IsBuilding();
+	}
+
+	if (PendingBuild.IsValid() && PendingBuild->IsFinished())
+	{
+		TUniquePtr<FBuild> Build = MoveTemp(PendingBuild);
+		CommitBuild(*Build);
+		bChanged = true;
+	}
+
+	return bChanged;
+}
+
+void FImGuiTextFilterView::Cancel()
+{
+	RetirePendingBuild();
+	ReleaseRetiredBuilds(true);
+
+	// Forget the request, so the next update can restart the build.
+	RequestedQuery = IndicesQuery;
+}
+
+void FImGuiTextFilterView::Wait()
+{
+	if (PendingBuild.IsValid())
+	{
+		PendingBuild->Task.Wait();
+		TUniquePtr<FBuild> Build = MoveTemp(PendingBuild);
+		CommitBuild(*Build);
+	}
+}
+
+void FImGuiTextFilterView::StartBuild(const ImGuiTextFilter& Filter, int32 ItemCount, uint32 SourceVersion)
+{
+	// A newer query makes the pending build obsolete.
+	RetirePendingBuild();
+
+	// Empty filter passes everything, so there is no need to read the source.
+	if (!Filter.IsActive())
+	{
+		Indices.SetNumUninitialized(ItemCount);
+		for (int32 Index = 0; Index < ItemCount; Index++)
+		{
+			Indices[Index] = Index;
+		}
+		IndicesQuery.Set(Filter.InputBuf, ItemCount, SourceVersion);
+		return;
+	}
+
+	TUniquePtr<FBuild> Build = MakeUnique<FBuild>(Filter.InputBuf, ItemCount, SourceVersion);
+
+	// If the last result comes from the same source and the new filter is narrower, only refine that result.
+	Build->bRefine = IndicesQuery.bValid && IndicesQuery.ItemCount == ItemCount
+		&& IndicesQuery.SourceVersion == SourceVersion && IsNarrowing(IndicesQuery.Text.GetData(), Filter.InputBuf);
+	if (Build->bRefine)
+	{
+		Build->Candidates = Indices;
+	}
+
+	const int32 ScanCount = Build->bRefine ? Build->Candidates.Num() : ItemCount;
+	if (ScanCount <= SynchronousBuildLimit)
+	{
+		Build->Run(GetItemName);
+		CommitBuild(*Build);
+	}
+	else
+	{
+		FBuild* BuildPtr = Build.Get();
+		const FGetItemName* GetItemNamePtr = &GetItemName;
+		Build->Task = Async(EAsyncExecution::ThreadPool, [BuildPtr, GetItemNamePtr]() { BuildPtr->Run(*GetItemNamePtr); });
+		PendingBuild = MoveTemp(Build);
+	}
+}
+
+void FImGuiTextFilterView::CommitBuild(FBuild& Build)
+{
+	Indices = MoveTemp(Build.Result);
+	IndicesQuery.Set(Build.Filter.InputBuf, Build.ItemCount, Build.SourceVersion);
+}
+
+void FImGuiTextFilterView::RetirePendingBuild()
+{
+	if (PendingBuild.IsValid())
+	{
+		PendingBuild->bCancelled.store(true, std::memory_order_relaxed);
+		RetiredBuilds.Add(MoveTemp(PendingBuild));
+	}
+}
+
+void FImGuiTextFilterView::ReleaseRetiredBuilds(bool bWait)
+{
+	for (int32 Index = RetiredBuilds.Num() - 1; Index >= 0; Index--)
+	{
+		if (bWait)
+		{
+			RetiredBuilds[Index]->Task.Wait();
+		}
+
+		if (RetiredBuilds[Index]->IsFinished())
+		{
+			RetiredBuilds.RemoveAtSwap(Index, 1, false);
+		}
+	}
+}
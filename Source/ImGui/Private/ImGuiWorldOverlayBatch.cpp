@@ -0,0 +1,307 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiWorldOverlayBatch.h"
+
+#include <Containers/StringConv.h>
+
+
+namespace
+{
+	// Number of points projected in one block.
+	constexpr int32 BlockSize = 64;
+
+	// Points with clip-space W below this value are behind the view or too close to its origin.
+	constexpr float MinClipW = 1.e-3f;
+
+	// Clip-space coordinates of a block of points, stored as a structure of arrays.
+	struct FClipBlock
+	{
+		float X[BlockSize];
+		float Y[BlockSize];
+		float W[BlockSize];
+	};
+
+	// Point that passed frustum culling.
+	struct FProjectedPoint
+	{
+		ImVec2 Position;
+		float Depth;
+		int32 Index;
+	};
+
+	FORCEINLINE ImU32 ToImU32(const FColor& Color)
+	{
+		return IM_COL32(Color.R, Color.G, Color.B, Color.A);
+	}
+
+	// Transform a block of points to clip space. Loops operate on plain arrays and are kept free of branches, so the
+	// compiler can vectorise them. Points are translated to the view origin in double precision (when available) before
+	// switching to floats.
+	void ProjectBlock(const FVector* Points, int32 Num, const FVector& Origin, const float (&M)[4][4], FClipBlock& Out)
+	{
+		float PX[BlockSize];
+		float PY[BlockSize];
+		float PZ[BlockSize];
+
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			PX[Index] = static_cast<float>(Points[Index].X - Origin.X);
+			PY[Index] = static_cast<float>(Points[Index].Y - Origin.Y);
+			PZ[Index] = static_cast<float>(Points[Index].Z - Origin.Z);
+		}
+
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			Out.X[Index] = PX[Index] * M[0][0] + PY[Index] * M[1][0] + PZ[Index] * M[2][0] + M[3][0];
+			Out.Y[Index] = PX[Index] * M[0][1] + PY[Index] * M[1][1] + PZ[Index] * M[2][1] + M[3][1];
+			Out.W[Index] = PX[Index] * M[0][3] + PY[Index] * M[1][3] + PZ[Index] * M[2][3] + M[3][3];
+		}
+	}
+
+	// Cull projected block against the view frustum and convert remaining points to ImGui space.
+	// @returns Number of visible points written to the output
+	int32 CullBlock(const FClipBlock& Clip, int32 Num, int32 FirstIndex, const ImVec2& Scale, const ImVec2& Offset, FProjectedPoint* Out)
+	{
+		uint8 Visible[BlockSize];
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			const float W = Clip.W[Index];
+			Visible[Index] = (W > MinClipW) & (FMath::Abs(Clip.X[Index]) <= W) & (FMath::Abs(Clip.Y[Index]) <= W);
+		}
+
+		int32 NumVisible = 0;
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			if (Visible[Index])
+			{
+				const float InvW = 1.f / Clip.W[Index];
+				Out[NumVisible++] = { { Clip.X[Index] * InvW * Scale.x + Offset.x, Clip.Y[Index] * InvW * Scale.y + Offset.y },
+					Clip.W[Index], FirstIndex + Index };
+			}
+		}
+
+		return NumVisible;
+	}
+}
+
+void FImGuiWorldOverlayBatch::SetView(const FVector& InViewOrigin, const FMatrix& TranslatedViewProjection,
+	const FVector2D& NDCToImGuiScale, const FVector2D& NDCToImGuiOffset)
+{
+	ViewOrigin = InViewOrigin;
+
+	for (int32 Row = 0; Row < 4; Row++)
+	{
+		for (int32 Column = 0; Column < 4; Column++)
+		{
+			ViewProjection[Row][Column] = static_cast<float>(TranslatedViewProjection.M[Row][Column]);
+		}
+	}
+
+	NDCScale = { static_cast<float>(NDCToImGuiScale.X), static_cast<float>(NDCToImGuiScale.Y) };
+	NDCOffset = { static_cast<float>(NDCToImGuiOffset.X), static_cast<float>(NDCToImGuiOffset.Y) };
+
+	bHasView = true;
+}
+
+void FImGuiWorldOverlayBatch::AddPoints(TArrayView<const FVector> InPoints, const FColor& Color, float Size)
+{
+	if (InPoints.Num() > 0)
+	{
+		Points.Append(InPoints.GetData(), InPoints.Num());
+		PointRanges.Add({ Points.Num(), ToImU32(Color), Size });
+	}
+}
+
+void FImGuiWorldOverlayBatch::AddLines(TArrayView<const FVector> InLinePoints, const FColor& Color, float Thickness)
+{
+	// Lines are stored in pairs, so if we have an odd number of points, we skip the last one.
+	const int32 Num = InLinePoints.Num() & ~1;
+	if (Num > 0)
+	{
+		LinePoints.Append(InLinePoints.GetData(), Num);
+		LineRanges.Add({ LinePoints.Num(), ToImU32(Color), Thickness });
+	}
+}
+
+void FImGuiWorldOverlayBatch::AddLabels(TArrayView<const FVector> Locations, TArrayView<const FString> InLabels, const FColor& Color)
+{
+	const int32 Num = FMath::Min(Locations.Num(), InLabels.Num());
+	if (Num > 0)
+	{
+		const ImU32 LabelColor = ToImU32(Color);
+
+		LabelLocations.Append(Locations.GetData(), Num);
+
+		// Convert texts once during submission, so we don't need to keep references to the source strings.
+		for (int32 Index = 0; Index < Num; Index++)
+		{
+			FTCHARToUTF8 Text(*InLabels[Index]);
+			const int32 TextBegin = LabelText.Num();
+			LabelText.Append(reinterpret_cast<const ANSICHAR*>(Text.Get()), Text.Length());
+			Labels.Add({ TextBegin, LabelText.Num(), LabelColor });
+		}
+	}
+}
+
+void FImGuiWorldOverlayBatch::Draw(ImDrawList& DrawList)
+{
+	if (bHasView)
+	{
+		DrawLines(DrawList);
+		DrawPoints(DrawList);
+		DrawLabels(DrawList);
+	}
+
+	Reset();
+}
+
+void FImGuiWorldOverlayBatch::Reset()
+{
+	Points.Reset();
+	PointRanges.Reset();
+
+	LinePoints.Reset();
+	LineRanges.Reset();
+
+	LabelLocations.Reset();
+	Labels.Reset();
+	LabelText.Reset();
+}
+
+void FImGuiWorldOverlayBatch::DrawPoints(ImDrawList& DrawList)
+{
+	FClipBlock Clip;
+	FProjectedPoint Projected[BlockSize];
+
+	int32 RangeBegin = 0;
+	for (const FStyleRange& Range : PointRanges)
+	{
+		const ImVec2 HalfSize{ Range.Size * 0.5f, Range.Size * 0.5f };
+
+		for (int32 BlockBegin = RangeBegin; BlockBegin < Range.End; BlockBegin += BlockSize)
+		{
+			const int32 Num = FMath::Min(BlockSize, Range.End - BlockBegin);
+			ProjectBlock(&Points[BlockBegin], Num, ViewOrigin, ViewProjection, Clip);
+
+			const int32 NumVisible = CullBlock(Clip, Num, BlockBegin, NDCScale, NDCOffset, Projected);
+			if (NumVisible > 0)
+			{
+				// Write quads directly to the vertex and index buffers.
+				DrawList.PrimReserve(NumVisible * 6, NumVisible * 4);
+				for (int32 Index = 0; Index < NumVisible; Index++)
+				{
+					DrawList.PrimRect(Projected[Index].Position - HalfSize, Projected[Index].Position + HalfSize, Range.Color);
+				}
+			}
+		}
+
+		RangeBegin = Range.End;
+	}
+}
+
+void FImGuiWorldOverlayBatch::DrawLines(ImDrawList& DrawList)
+{
+	FClipBlock Clip;
+	ImVec2 Segments[BlockSize];
+
+	const ImVec2 UV = DrawList._Data->TexUvWhitePixel;
+
+	int32 RangeBegin = 0;
+	for (const FStyleRange& Range : LineRanges)
+	{
+		const float HalfThickness = Range.Size * 0.5f;
+
+		// Block size is even, so blocks never split lines.
+		for (int32 BlockBegin = RangeBegin; BlockBegin < Range.End; BlockBegin += BlockSize)
+		{
+			const int32 Num = FMath::Min(BlockSize, Range.End - BlockBegin);
+			ProjectBlock(&LinePoints[BlockBegin], Num, ViewOrigin, ViewProjection, Clip);
+
+			int32 NumVisible = 0;
+			for (int32 Index = 0; Index < Num; Index += 2)
+			{
+				float AX = Clip.X[Index], AY = Clip.Y[Index], AW = Clip.W[Index];
+				float BX = Clip.X[Index + 1], BY = Clip.Y[Index + 1], BW = Clip.W[Index + 1];
+
+				// Skip lines that are completely behind the view or outside of one of the side planes.
+				const bool bCulled = (AW <= MinClipW && BW <= MinClipW)
+					|| (AX > AW && BX > BW) || (AX < -AW && BX < -BW)
+					|| (AY > AW && BY > BW) || (AY < -AW && BY < -BW);
+				if (bCulled)
+				{
+					continue;
+				}
+
+				// Clip lines crossing the near plane. Remaining clipping is handled by ImGui.
+				if (AW <= MinClipW)
+				{
+					const float T = (MinClipW - AW) / (BW - AW);
+					AX += (BX - AX) * T;
+					AY += (BY - AY) * T;
+					AW = MinClipW;
+				}
+				else if (BW <= MinClipW)
+				{
+					const float T = (MinClipW - BW) / (AW - BW);
+					BX += (AX - BX) * T;
+					BY += (AY - BY) * T;
+					BW = MinClipW;
+				}
+
+				Segments[NumVisible++] = { AX / AW * NDCScale.x + NDCOffset.x, AY / AW * NDCScale.y + NDCOffset.y };
+				Segments[NumVisible++] = { BX / BW * NDCScale.x + NDCOffset.x, BY / BW * NDCScale.y + NDCOffset.y };
+			}
+
+			if (NumVisible > 0)
+			{
+				// Write quads directly to the vertex and index buffers.
+				DrawList.PrimReserve(NumVisible * 3, NumVisible * 2);
+				for (int32 Index = 0; Index < NumVisible; Index += 2)
+				{
+					const ImVec2& A = Segments[Index];
+					const ImVec2& B = Segments[Index + 1];
+
+					const ImVec2 Direction = B - A;
+					const float LengthSquared = Direction.x * Direction.x + Direction.y * Direction.y;
+					const float Scale = LengthSquared > 0.f ? HalfThickness / FMath::Sqrt(LengthSquared) : 0.f;
+					const ImVec2 Normal{ -Direction.y * Scale, Direction.x * Scale };
+
+					DrawList.PrimQuadUV(A + Normal, B + Normal, B - Normal, A - Normal, UV, UV, UV, UV, Range.Color);
+				}
+			}
+		}
+
+		RangeBegin = Range.End;
+	}
+}
+
+void FImGuiWorldOverlayBatch::DrawLabels(ImDrawList& DrawList)
+{
+	FClipBlock Clip;
+
+	TArray<FProjectedPoint> Projected;
+	Projected.SetNumUninitialized(Labels.Num());
+
+	int32 NumVisible = 0;
+	for (int32 BlockBegin = 0; BlockBegin < LabelLocations.Num(); BlockBegin += BlockSize)
+	{
+		const int32 Num = FMath::Min(BlockSize, LabelLocations.Num() - BlockBegin);
+		ProjectBlock(&LabelLocations[BlockBegin], Num, ViewOrigin, ViewProjection, Clip);
+		NumVisible += CullBlock(Clip, Num, BlockBegin, NDCScale, NDCOffset, &Projected[NumVisible]);
+	}
+	Projected.SetNum(NumVisible, false);
+
+	// Draw labels from back to front, so the nearest ones end up on top.
+	Projected.Sort([](const FProjectedPoint& A, const FProjectedPoint& B) { return A.Depth > B.Depth; });
+
+	for (const FProjectedPoint& Point : Projected)
+	{
+		const FLabel& Label = Labels[Point.Index];
+		const char* TextBegin = LabelText.GetData() + Label.TextBegin;
+		const char* TextEnd = LabelText.GetData() + Label.TextEnd;
+
+		const ImVec2 TextSize = ImGui::CalcTextSize(TextBegin, TextEnd);
+		const ImVec2 TextPosition = Point.Position - TextSize * 0.5f;
+		DrawList.AddText({ FMath::FloorToFloat(TextPosition.x), FMath::FloorToFloat(TextPosition.y) }, Label.Color, TextBegin, TextEnd);
+	}
+}
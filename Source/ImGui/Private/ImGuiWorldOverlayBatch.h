@@ -0,0 +1,82 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <Containers/Array.h>
+#include <Containers/ArrayView.h>
+#include <Math/Color.h>
+#include <Math/Matrix.h>
+#include <Math/Vector.h>
+#include <Math/Vector2D.h>
+
+#include <imgui.h>
+
+
+// Collects world-space debug primitives submitted to one context during a frame and draws them to an ImGui draw list.
+// Points are projected in fixed-size blocks stored as structure of arrays, with view-relative coordinates to keep
+// float precision in large worlds.
+class FImGuiWorldOverlayBatch
+{
+public:
+
+	// Set the view used to project primitives.
+	// @param ViewOrigin - World-space location of the view
+	// @param TranslatedViewProjection - View-projection matrix of the view translated to its origin
+	// @param NDCToImGuiScale - Scale converting normalized device coordinates to ImGui space
+	// @param NDCToImGuiOffset - Offset converting normalized device coordinates to ImGui space
+	void SetView(const FVector& ViewOrigin, const FMatrix& TranslatedViewProjection, const FVector2D& NDCToImGuiScale, const FVector2D& NDCToImGuiOffset);
+
+	// Forget the view. Without a view, primitives are discarded.
+	void ResetView() { bHasView = false; }
+
+	// Whether this batch has a view to project primitives.
+	bool HasView() const { return bHasView; }
+
+	void AddPoints(TArrayView<const FVector> Points, const FColor& Color, float Size);
+	void AddLines(TArrayView<const FVector> LinePoints, const FColor& Color, float Thickness);
+	void AddLabels(TArrayView<const FVector> Locations, TArrayView<const FString> Labels, const FColor& Color);
+
+	// Project, cull and draw all primitives collected in this frame and then clear the batch.
+	// @param DrawList - Draw list to which we want to draw
+	void Draw(ImDrawList& DrawList);
+
+	// Clear all collected primitives.
+	void Reset();
+
+private:
+
+	// Range of primitives submitted in one call, sharing the same style.
+	struct FStyleRange
+	{
+		int32 End;
+		ImU32 Color;
+		float Size;
+	};
+
+	struct FLabel
+	{
+		int32 TextBegin;
+		int32 TextEnd;
+		ImU32 Color;
+	};
+
+	void DrawPoints(ImDrawList& DrawList);
+	void DrawLines(ImDrawList& DrawList);
+	void DrawLabels(ImDrawList& DrawList);
+
+	TArray<FVector> Points;
+	TArray<FStyleRange> PointRanges;
+
+	TArray<FVector> LinePoints;
+	TArray<FStyleRange> LineRanges;
+
+	TArray<FVector> LabelLocations;
+	TArray<FLabel> Labels;
+	TArray<ANSICHAR> LabelText;
+
+	FVector ViewOrigin = FVector::ZeroVector;
+	float ViewProjection[4][4] = {};
+	ImVec2 NDCScale{ 1.f, 1.f };
+	ImVec2 NDCOffset{ 0.f, 0.f };
+	bool bHasView = false;
+};
@@ -0,0 +1,120 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiRemoteClient.h"
+
+#include <HAL/PlatformTime.h>
+#include <IPAddress.h>
+#include <Sockets.h>
+#include <SocketSubsystem.h>
+
+
+bool FImGuiRemoteClient::Connect(const FString& Address, int32 Port)
+{
+	Disconnect();
+
+	ISocketSubsystem* SocketSubsystem = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+
+	bool bIsValid = false;
+	TSharedRef<FInternetAddr> ServerAddress = SocketSubsystem->CreateInternetAddr();
+	ServerAddress->SetIp(*Address, bIsValid);
+	ServerAddress->SetPort(Port);
+
+	if (!bIsValid)
+	{
+		UE_LOG(LogImGuiRemote, Warning, TEXT("Invalid server address '%s'."), *Address);
+		return false;
+	}
+
+	FSocket* Socket = SocketSubsystem->CreateSocket(NAME_Stream, TEXT("ImGuiRemoteClient"), false);
+	if (!Socket || !Socket->Connect(*ServerAddress))
+	{
+		UE_LOG(LogImGuiRemote, Warning, TEXT("Couldn't connect to '%s'."), *ServerAddress->ToString(true));
+		if (Socket)
+		{
+			SocketSubsystem->DestroySocket(Socket);
+		}
+		return false;
+	}
+
+	Connection = MakeUnique<ImGuiRemote::FConnection>(Socket);
+	Connection->Send(ImGuiRemote::EMessageType::Hello, ImGuiRemote::MakeHello());
+	Connection->Flush();
+
+	Decoder.Reset();
+	Stats = FStats{};
+	return true;
+}
+
+void FImGuiRemoteClient::Disconnect()
+{
+	Connection.Reset();
+	DrawLists.Empty();
+}
+
+void FImGuiRemoteClient::Tick()
+{
+	if (IsConnected())
+	{
+		Connection->Flush();
+		Connection->Receive();
+
+		ImGuiRemote::EMessageType Type;
+		TArray<uint8> Payload;
+		bool bCompressed;
+		while (IsConnected() && Connection->ReadMessage(Type, Payload, bCompressed))
+		{
+			HandleMessage(Type, Payload, bCompressed);
+		}
+	}
+}
+
+void FImGuiRemoteClient::SendInput(ImGuiRemote::FInput& Input)
+{
+	if (IsConnected())
+	{
+		Connection->Send(ImGuiRemote::EMessageType::Input, ImGuiRemote::MakeInput(Input));
+		Connection->Flush();
+	}
+}
+
+void FImGuiRemoteClient::HandleMessage(ImGuiRemote::EMessageType Type, const TArray<uint8>& Payload, bool bCompressed)
+{
+	switch (Type)
+	{
+	case ImGuiRemote::EMessageType::Hello:
+		if (!ImGuiRemote::CheckHello(Payload))
+		{
+			UE_LOG(LogImGuiRemote, Warning, TEXT("Server uses a different protocol version. Disconnecting."));
+			Disconnect();
+		}
+		break;
+
+	case ImGuiRemote::EMessageType::FontAtlas:
+		if (!ImGuiRemote::ReadFontAtlas(Payload, bCompressed, FontAtlas))
+		{
+			Stats.NumErrors++;
+		}
+		break;
+
+	case ImGuiRemote::EMessageType::Frame:
+		if (Decoder.Decode(Payload, bCompressed, FrameInfo, DrawLists))
+		{
+			const double Latency = FPlatformTime::Seconds() - FrameInfo.EncodeTime;
+
+			Stats.NumFrames++;
+			Stats.NumKeyFrames += FrameInfo.bKeyFrame ? 1 : 0;
+			Stats.RawBytes += FrameInfo.RawSize;
+			Stats.CompressedBytes += FrameInfo.CompressedSize;
+			Stats.TotalLatency += Latency;
+			Stats.MaxLatency = FMath::Max(Stats.MaxLatency, Latency);
+		}
+		else
+		{
+			Stats.NumErrors++;
+		}
+		break;
+
+	default:
+		break;
+	}
+}
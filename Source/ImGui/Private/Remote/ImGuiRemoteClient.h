@@ -0,0 +1,82 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiRemoteConnection.h"
+#include "ImGuiRemoteProtocol.h"
+
+#include <Templates/UniquePtr.h>
+
+
+// Client receiving ImGui output streamed by FImGuiRemoteServer. It decodes frames and collects statistics about the
+// stream, which allows to verify streaming locally.
+class FImGuiRemoteClient
+{
+public:
+
+	struct FStats
+	{
+		int32 NumFrames = 0;
+		int32 NumKeyFrames = 0;
+		int32 NumErrors = 0;
+
+		// Sizes of the decoded frames before and after compression.
+		int64 RawBytes = 0;
+		int64 CompressedBytes = 0;
+
+		// Time between encoding and decoding frames. Only meaningful when both ends run on the same machine.
+		double TotalLatency = 0.0;
+		double MaxLatency = 0.0;
+	};
+
+	FImGuiRemoteClient() = default;
+
+	FImGuiRemoteClient(const FImGuiRemoteClient&) = delete;
+	FImGuiRemoteClient& operator=(const FImGuiRemoteClient&) = delete;
+
+	// Connect to a server.
+	// @param Address - IP address of the server
+	// @param Port - Port on which server is listening
+	// @returns True, if connection was established
+	bool Connect(const FString& Address, int32 Port);
+
+	// Close the connection.
+	void Disconnect();
+
+	// Whether client is connected.
+	bool IsConnected() const { return Connection.IsValid() && Connection->IsOpen(); }
+
+	// Receive and decode all available messages and send queued input.
+	void Tick();
+
+	// Queue input to send to the server.
+	void SendInput(ImGuiRemote::FInput& Input);
+
+	// Get draw lists from the last decoded frame.
+	const TArray<FImGuiDrawList>& GetDrawLists() const { return DrawLists; }
+
+	// Get information about the last decoded frame.
+	const ImGuiRemote::FFrameInfo& GetFrameInfo() const { return FrameInfo; }
+
+	// Get the last received font atlas.
+	const ImGuiRemote::FFontAtlasTexture& GetFontAtlas() const { return FontAtlas; }
+
+	// Get statistics collected since connecting.
+	const FStats& GetStats() const { return Stats; }
+
+	// Get the total number of bytes received since connecting.
+	int64 GetBytesReceived() const { return Connection.IsValid() ? Connection->GetBytesReceived() : 0; }
+
+private:
+
+	void HandleMessage(ImGuiRemote::EMessageType Type, const TArray<uint8>& Payload, bool bCompressed);
+
+	TUniquePtr<ImGuiRemote::FConnection> Connection;
+	ImGuiRemote::FFrameDecoder Decoder;
+
+	TArray<FImGuiDrawList> DrawLists;
+	ImGuiRemote::FFrameInfo FrameInfo;
+	ImGuiRemote::FFontAtlasTexture FontAtlas;
+
+	FStats Stats;
+};
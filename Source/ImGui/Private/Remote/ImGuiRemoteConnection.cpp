@@ -0,0 +1,120 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiRemoteConnection.h"
+
+#include <Sockets.h>
+#include <SocketSubsystem.h>
+
+
+namespace ImGuiRemote
+{
+	FConnection::FConnection(FSocket* InSocket)
+		: Socket(InSocket)
+	{
+		checkf(Socket, TEXT("Null socket."));
+		Socket->SetNonBlocking(true);
+		Socket->SetNoDelay(true);
+	}
+
+	FConnection::~FConnection()
+	{
+		Close();
+	}
+
+	void FConnection::Send(EMessageType Type, const TArray<uint8>& Payload, bool bCompressed)
+	{
+		// Drop data that were already sent before appending, so the buffer doesn't grow with every message.
+		if (SendOffset > 0)
+		{
+			SendBuffer.RemoveAt(0, SendOffset, false);
+			SendOffset = 0;
+		}
+
+		WriteMessage(SendBuffer, Type, Payload, bCompressed);
+	}
+
+	void FConnection::Flush()
+	{
+		while (Socket && HasPendingSend())
+		{
+			int32 Sent = 0;
+			if (!Socket->Send(SendBuffer.GetData() + SendOffset, SendBuffer.Num() - SendOffset, Sent))
+			{
+				if (!IsWouldBlockError())
+				{
+					Close();
+				}
+				return;
+			}
+
+			if (Sent <= 0)
+			{
+				return;
+			}
+
+			SendOffset += Sent;
+			BytesSent += Sent;
+		}
+	}
+
+	void FConnection::Receive()
+	{
+		if (Socket && Socket->GetConnectionState() == SCS_ConnectionError)
+		{
+			Close();
+		}
+
+		uint32 PendingSize = 0;
+		while (Socket && Socket->HasPendingData(PendingSize) && PendingSize > 0)
+		{
+			const int32 Offset = ReceiveBuffer.Num();
+			ReceiveBuffer.AddUninitialized(PendingSize);
+
+			int32 Read = 0;
+			const bool bSuccess = Socket->Recv(ReceiveBuffer.GetData() + Offset, PendingSize, Read);
+			ReceiveBuffer.SetNum(Offset + FMath::Max(Read, 0), false);
+
+			if (!bSuccess && !IsWouldBlockError())
+			{
+				Close();
+			}
+			else if (Read <= 0)
+			{
+				break;
+			}
+
+			BytesReceived += Read;
+		}
+	}
+
+	bool FConnection::ReadMessage(EMessageType& OutType, TArray<uint8>& OutPayload, bool& bOutCompressed)
+	{
+		bool bError = false;
+		const bool bRead = ImGuiRemote::ReadMessage(ReceiveBuffer, OutType, OutPayload, bOutCompressed, bError);
+		if (bError)
+		{
+			UE_LOG(LogImGuiRemote, Warning, TEXT("Received invalid data. Closing the connection."));
+			Close();
+		}
+		return bRead;
+	}
+
+	void FConnection::Close()
+	{
+		if (Socket)
+		{
+			Socket->Close();
+			ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(Socket);
+			Socket = nullptr;
+		}
+
+		SendBuffer.Empty();
+		SendOffset = 0;
+		ReceiveBuffer.Empty();
+	}
+
+	bool FConnection::IsWouldBlockError() const
+	{
+		return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK;
+	}
+}
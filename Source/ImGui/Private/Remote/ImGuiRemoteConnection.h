@@ -0,0 +1,71 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiRemoteProtocol.h"
+
+
+class FSocket;
+
+namespace ImGuiRemote
+{
+	// Non-blocking connection which buffers outgoing and incoming messages. Owns the socket.
+	class FConnection
+	{
+	public:
+
+		explicit FConnection(FSocket* InSocket);
+		~FConnection();
+
+		FConnection(const FConnection&) = delete;
+		FConnection& operator=(const FConnection&) = delete;
+
+		// Whether connection is still open.
+		bool IsOpen() const { return Socket != nullptr; }
+
+		// Queue a message to send.
+		// @param Type - Message type
+		// @param Payload - Message payload
+		// @param bCompressed - Whether the payload contains compressed data
+		void Send(EMessageType Type, const TArray<uint8>& Payload, bool bCompressed = false);
+
+		// Whether there are queued data that were not yet sent.
+		bool HasPendingSend() const { return SendOffset < SendBuffer.Num(); }
+
+		// Send as much queued data as possible without blocking.
+		void Flush();
+
+		// Receive all available data without blocking.
+		void Receive();
+
+		// Get the next received message.
+		// @param OutType - Type of the message
+		// @param OutPayload - Payload of the message
+		// @param bOutCompressed - Whether the payload contains compressed data
+		// @returns True, if a message was read
+		bool ReadMessage(EMessageType& OutType, TArray<uint8>& OutPayload, bool& bOutCompressed);
+
+		// Close the connection and release the socket.
+		void Close();
+
+		// Get the total number of bytes sent.
+		int64 GetBytesSent() const { return BytesSent; }
+
+		// Get the total number of bytes received.
+		int64 GetBytesReceived() const { return BytesReceived; }
+
+	private:
+
+		bool IsWouldBlockError() const;
+
+		FSocket* Socket = nullptr;
+
+		TArray<uint8> SendBuffer;
+		int32 SendOffset = 0;
+
+		TArray<uint8> ReceiveBuffer;
+
+		int64 BytesSent = 0;
+		int64 BytesReceived = 0;
+	};
+}
@@ -0,0 +1,470 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiRemoteProtocol.h"
+
+#include "ImGuiInputState.h"
+#include "ImGuiInteroperability.h"
+
+#include <Containers/ArrayView.h>
+#include <Input/Events.h>
+#include <InputCoreTypes.h>
+#include <Misc/Compression.h>
+#include <Serialization/MemoryReader.h>
+#include <Serialization/MemoryWriter.h>
+
+#include <imgui.h>
+
+
+DEFINE_LOG_CATEGORY(LogImGuiRemote);
+
+namespace ImGuiRemote
+{
+	namespace
+	{
+		// Compress data with LZ4, appending them to the output. If compression fails, data are appended uncompressed.
+		// @param bOutCompressed - Whether appended data are compressed
+		// @returns Size of the appended data
+		int32 Compress(const TArray<uint8>& Data, TArray<uint8>& Out, bool& bOutCompressed)
+		{
+			const int32 Offset = Out.Num();
+			int32 CompressedSize = FCompression::CompressMemoryBound(NAME_LZ4, Data.Num());
+			Out.AddUninitialized(CompressedSize);
+
+			bOutCompressed = FCompression::CompressMemory(NAME_LZ4, Out.GetData() + Offset, CompressedSize, Data.GetData(), Data.Num());
+			if (!bOutCompressed)
+			{
+				CompressedSize = Data.Num();
+				FMemory::Memcpy(Out.GetData() + Offset, Data.GetData(), CompressedSize);
+			}
+
+			Out.SetNum(Offset + CompressedSize, false);
+			return CompressedSize;
+		}
+
+		bool Uncompress(const uint8* Data, int32 Size, bool bCompressed, int32 UncompressedSize, TArray<uint8>& Out)
+		{
+			// Size comes from the network, so it needs to be validated before allocating the output.
+			if (UncompressedSize < 0 || UncompressedSize > MaxUncompressedSize || Size < 0)
+			{
+				return false;
+			}
+
+			if (!bCompressed && Size != UncompressedSize)
+			{
+				return false;
+			}
+
+			Out.SetNumUninitialized(UncompressedSize, false);
+			if (!bCompressed)
+			{
+				FMemory::Memcpy(Out.GetData(), Data, Size);
+				return true;
+			}
+			return FCompression::UncompressMemory(NAME_LZ4, Out.GetData(), UncompressedSize, Data, Size);
+		}
+
+		// Keys that can be sent by remote clients. Keys are sent as indices in this table, so received data never create
+		// new names. Append new keys at the end to keep indices stable.
+		TArrayView<const FKey> GetRemoteKeys()
+		{
+			static const FKey Keys[] =
+			{
+				EKeys::LeftMouseButton, EKeys::RightMouseButton, EKeys::MiddleMouseButton, EKeys::ThumbMouseButton,
+				EKeys::ThumbMouseButton2,
+
+				EKeys::LeftShift, EKeys::RightShift, EKeys::LeftControl, EKeys::RightControl, EKeys::LeftAlt, EKeys::RightAlt,
+				EKeys::LeftCommand, EKeys::RightCommand,
+
+				EKeys::Tab, EKeys::Left, EKeys::Right, EKeys::Up, EKeys::Down, EKeys::PageUp, EKeys::PageDown, EKeys::Home,
+				EKeys::End, EKeys::Insert, EKeys::Delete, EKeys::NumLock, EKeys::ScrollLock, EKeys::Pause, EKeys::BackSpace,
+				EKeys::SpaceBar, EKeys::Enter, EKeys::Escape,
+
+				EKeys::A, EKeys::B, EKeys::C, EKeys::D, EKeys::E, EKeys::F, EKeys::G, EKeys::H, EKeys::I, EKeys::J, EKeys::K,
+				EKeys::L, EKeys::M, EKeys::N, EKeys::O, EKeys::P, EKeys::Q, EKeys::R, EKeys::S, EKeys::T, EKeys::U, EKeys::V,
+				EKeys::W, EKeys::X, EKeys::Y, EKeys::Z,
+
+				EKeys::F1, EKeys::F2, EKeys::F3, EKeys::F4, EKeys::F5, EKeys::F6, EKeys::F7, EKeys::F8, EKeys::F9, EKeys::F10,
+				EKeys::F11, EKeys::F12,
+
+				EKeys::Zero, EKeys::One, EKeys::Two, EKeys::Three, EKeys::Four, EKeys::Five, EKeys::Six, EKeys::Seven,
+				EKeys::Eight, EKeys::Nine,
+
+				EKeys::Equals, EKeys::Comma, EKeys::Period, EKeys::Slash, EKeys::LeftBracket, EKeys::RightBracket,
+				EKeys::Apostrophe, EKeys::Semicolon, EKeys::Hyphen, EKeys::Backslash, EKeys::Tilde,
+
+				EKeys::NumPadZero, EKeys::NumPadOne, EKeys::NumPadTwo, EKeys::NumPadThree, EKeys::NumPadFour,
+				EKeys::NumPadFive, EKeys::NumPadSix, EKeys::NumPadSeven, EKeys::NumPadEight, EKeys::NumPadNine,
+				EKeys::Multiply, EKeys::Add, EKeys::Subtract, EKeys::Decimal, EKeys::Divide
+			};
+			return Keys;
+		}
+
+		// Serialize keys as indices in the table of remote keys. Keys that are not in the table are not sent.
+		void SerializeKeys(FArchive& Ar, TArray<FName>& Keys)
+		{
+			const TArrayView<const FKey> RemoteKeys = GetRemoteKeys();
+
+			if (Ar.IsLoading())
+			{
+				uint8 Num = 0;
+				Ar << Num;
+				if (Ar.IsError() || Num > MaxInputKeys)
+				{
+					Ar.SetError();
+					return;
+				}
+
+				Keys.Reset(Num);
+				for (int32 Index = 0; Index < Num; Index++)
+				{
+					uint8 KeyIndex = 0;
+					Ar << KeyIndex;
+					if (Ar.IsError() || !RemoteKeys.IsValidIndex(KeyIndex))
+					{
+						Ar.SetError();
+						return;
+					}
+					Keys.Add(RemoteKeys[KeyIndex].GetFName());
+				}
+			}
+			else
+			{
+				TArray<uint8, TInlineAllocator<MaxInputKeys>> KeyIndices;
+				for (const FName& Key : Keys)
+				{
+					const int32 KeyIndex = RemoteKeys.IndexOfByPredicate([&Key](const FKey& RemoteKey) { return RemoteKey.GetFName() == Key; });
+					if (KeyIndex != INDEX_NONE && KeyIndices.Num() < MaxInputKeys)
+					{
+						KeyIndices.Add((uint8)KeyIndex);
+					}
+				}
+
+				uint8 Num = (uint8)KeyIndices.Num();
+				Ar << Num;
+				Ar.Serialize(KeyIndices.GetData(), Num);
+			}
+		}
+
+		// Serialize characters as UTF-16 code units with a limited length.
+		void SerializeCharacters(FArchive& Ar, FString& Characters)
+		{
+			uint16 Num = (uint16)FMath::Min(Characters.Len(), MaxInputCharacters);
+			Ar << Num;
+
+			if (Ar.IsLoading())
+			{
+				if (Ar.IsError() || Num > MaxInputCharacters || Num * (int64)sizeof(uint16) > Ar.TotalSize() - Ar.Tell())
+				{
+					Ar.SetError();
+					return;
+				}
+				Characters.Reset(Num);
+			}
+
+			for (int32 Index = 0; Index < Num; Index++)
+			{
+				uint16 Char = Ar.IsLoading() ? 0 : (uint16)Characters[Index];
+				Ar << Char;
+				if (Ar.IsLoading())
+				{
+					Characters.AppendChar((TCHAR)Char);
+				}
+			}
+		}
+
+		// XOR destination with source in the range where both buffers overlap.
+		void Xor(TArray<uint8>& Dest, const TArray<uint8>& Src)
+		{
+			const int32 Num = FMath::Min(Dest.Num(), Src.Num());
+			uint8* DestData = Dest.GetData();
+			const uint8* SrcData = Src.GetData();
+
+			int32 Index = 0;
+			for (; Index + (int32)sizeof(uint64) <= Num; Index += sizeof(uint64))
+			{
+				uint64 DestWord, SrcWord;
+				FMemory::Memcpy(&DestWord, DestData + Index, sizeof(uint64));
+				FMemory::Memcpy(&SrcWord, SrcData + Index, sizeof(uint64));
+				DestWord ^= SrcWord;
+				FMemory::Memcpy(DestData + Index, &DestWord, sizeof(uint64));
+			}
+			for (; Index < Num; Index++)
+			{
+				DestData[Index] ^= SrcData[Index];
+			}
+		}
+	}
+
+	void WriteMessage(TArray<uint8>& Buffer, EMessageType Type, const TArray<uint8>& Payload, bool bCompressed)
+	{
+		FMemoryWriter Writer(Buffer);
+		Writer.Seek(Buffer.Num());
+
+		uint32 PayloadSize = Payload.Num();
+		uint8 TypeValue = static_cast<uint8>(Type);
+		uint8 FlagsValue = static_cast<uint8>(bCompressed ? EMessageFlags::Compressed : EMessageFlags::None);
+		Writer << PayloadSize << TypeValue << FlagsValue;
+
+		Buffer.Append(Payload);
+	}
+
+	bool ReadMessage(TArray<uint8>& Buffer, EMessageType& OutType, TArray<uint8>& OutPayload, bool& bOutCompressed, bool& bOutError)
+	{
+		bOutError = false;
+		if (Buffer.Num() < HeaderSize)
+		{
+			return false;
+		}
+
+		FMemoryReader Reader(Buffer);
+
+		uint32 PayloadSize;
+		uint8 TypeValue;
+		uint8 FlagsValue;
+		Reader << PayloadSize << TypeValue << FlagsValue;
+
+		if (PayloadSize > (uint32)MaxPayloadSize || TypeValue > (uint8)EMessageType::Input
+			|| (FlagsValue & ~(uint8)EMessageFlags::All) != 0)
+		{
+			bOutError = true;
+			return false;
+		}
+
+		if (Buffer.Num() < HeaderSize + (int32)PayloadSize)
+		{
+			return false;
+		}
+
+		OutType = static_cast<EMessageType>(TypeValue);
+		bOutCompressed = (FlagsValue & (uint8)EMessageFlags::Compressed) != 0;
+		OutPayload.Reset(PayloadSize);
+		OutPayload.Append(Buffer.GetData() + HeaderSize, PayloadSize);
+		Buffer.RemoveAt(0, HeaderSize + PayloadSize, false);
+		return true;
+	}
+
+	TArray<uint8> MakeHello()
+	{
+		TArray<uint8> Payload;
+		FMemoryWriter Writer(Payload);
+
+		uint32 Version = ProtocolVersion;
+		Writer << Version;
+
+		return Payload;
+	}
+
+	bool CheckHello(const TArray<uint8>& Payload)
+	{
+		FMemoryReader Reader(Payload);
+
+		uint32 Version = 0;
+		Reader << Version;
+
+		return !Reader.IsError() && Version == ProtocolVersion;
+	}
+
+	TArray<uint8> MakeFontAtlas(ImFontAtlas& FontAtlas, bool& bOutCompressed)
+	{
+		unsigned char* Pixels;
+		int Width, Height, Bpp;
+		FontAtlas.GetTexDataAsRGBA32(&Pixels, &Width, &Height, &Bpp);
+
+		const TArray<uint8> PixelData(Pixels, Width * Height * Bpp);
+
+		TArray<uint8> Payload;
+		FMemoryWriter Writer(Payload);
+
+		int32 SizeX = Width;
+		int32 SizeY = Height;
+		TextureIndex Texture = ImGuiInterops::ToTextureIndex(FontAtlas.TexID);
+		int32 RawSize = PixelData.Num();
+		Writer << SizeX << SizeY << Texture << RawSize;
+
+		Compress(PixelData, Payload, bOutCompressed);
+		return Payload;
+	}
+
+	bool ReadFontAtlas(const TArray<uint8>& Payload, bool bCompressed, FFontAtlasTexture& OutFontAtlas)
+	{
+		FMemoryReader Reader(Payload);
+
+		int32 RawSize = 0;
+		Reader << OutFontAtlas.Width << OutFontAtlas.Height << OutFontAtlas.Texture << RawSize;
+
+		// Compute the expected size in 64 bits, so invalid dimensions cannot overflow into a matching size.
+		if (Reader.IsError() || OutFontAtlas.Width < 0 || OutFontAtlas.Height < 0
+			|| (int64)RawSize != (int64)OutFontAtlas.Width * OutFontAtlas.Height * 4)
+		{
+			return false;
+		}
+
+		const int32 Offset = Reader.Tell();
+		return Uncompress(Payload.GetData() + Offset, Payload.Num() - Offset, bCompressed, RawSize, OutFontAtlas.Pixels);
+	}
+
+	void FFrameEncoder::Encode(FFrameInfo& Info, const TArray<FImGuiDrawList>& DrawLists, TArray<uint8>& OutPayload)
+	{
+		// Serialize draw lists (saving archive doesn't modify serialized objects).
+		Frame.Reset();
+		FMemoryWriter FrameWriter(Frame);
+		FrameWriter << const_cast<TArray<FImGuiDrawList>&>(DrawLists);
+
+		// XOR with the previous frame, keeping the current frame as a reference for the next one.
+		Delta = Frame;
+		Info.bKeyFrame = PreviousFrame.Num() == 0;
+		if (!Info.bKeyFrame)
+		{
+			Xor(Delta, PreviousFrame);
+		}
+		Swap(Frame, PreviousFrame);
+
+		Info.RawSize = Delta.Num();
+
+		// Write header and compressed data.
+		OutPayload.Reset();
+		FMemoryWriter Writer(OutPayload);
+
+		uint8 bKeyFrame = Info.bKeyFrame;
+		float DisplaySizeX = Info.DisplaySize.X;
+		float DisplaySizeY = Info.DisplaySize.Y;
+		Writer << Info.FrameNumber << Info.EncodeTime << DisplaySizeX << DisplaySizeY << bKeyFrame << Info.RawSize;
+
+		Info.CompressedSize = Compress(Delta, OutPayload, Info.bCompressed);
+	}
+
+	bool FFrameDecoder::Decode(const TArray<uint8>& Payload, bool bCompressed, FFrameInfo& OutInfo, TArray<FImGuiDrawList>& OutDrawLists)
+	{
+		FMemoryReader Reader(Payload);
+
+		uint8 bKeyFrame = 0;
+		float DisplaySizeX = 0.f;
+		float DisplaySizeY = 0.f;
+		Reader << OutInfo.FrameNumber << OutInfo.EncodeTime << DisplaySizeX << DisplaySizeY << bKeyFrame << OutInfo.RawSize;
+
+		OutInfo.DisplaySize = { DisplaySizeX, DisplaySizeY };
+		OutInfo.bKeyFrame = bKeyFrame != 0;
+		OutInfo.bCompressed = bCompressed;
+		OutInfo.CompressedSize = Payload.Num() - Reader.Tell();
+
+		// Delta frames can only be decoded, if we have the previous frame.
+		if (Reader.IsError() || (!OutInfo.bKeyFrame && PreviousFrame.Num() == 0))
+		{
+			return false;
+		}
+
+		if (!Uncompress(Payload.GetData() + Reader.Tell(), OutInfo.CompressedSize, bCompressed, OutInfo.RawSize, Frame))
+		{
+			return false;
+		}
+
+		if (!OutInfo.bKeyFrame)
+		{
+			Xor(Frame, PreviousFrame);
+		}
+		Swap(Frame, PreviousFrame);
+
+		// Frame data are serialized as an array of draw lists, but we read it manually to validate the number of lists.
+		FMemoryReader FrameReader(PreviousFrame);
+		int32 NumDrawLists = 0;
+		FrameReader << NumDrawLists;
+		if (FrameReader.IsError() || NumDrawLists < 0 || NumDrawLists > MaxDrawLists)
+		{
+			return false;
+		}
+
+		OutDrawLists.SetNum(NumDrawLists);
+		for (FImGuiDrawList& DrawList : OutDrawLists)
+		{
+			FrameReader << DrawList;
+		}
+
+		return !FrameReader.IsError() && FrameReader.AtEnd();
+	}
+
+	FArchive& operator<<(FArchive& Ar, FInput& Input)
+	{
+		float DisplaySizeX = Input.DisplaySize.X;
+		float DisplaySizeY = Input.DisplaySize.Y;
+		float MousePositionX = Input.MousePosition.X;
+		float MousePositionY = Input.MousePosition.Y;
+
+		uint8 Flags = (Input.bHasMousePointer ? 1 : 0) | (Input.bIsControlDown ? 2 : 0) | (Input.bIsShiftDown ? 4 : 0)
+			| (Input.bIsAltDown ? 8 : 0);
+
+		Ar << DisplaySizeX << DisplaySizeY << MousePositionX << MousePositionY << Input.MouseWheelDelta << Flags;
+		SerializeKeys(Ar, Input.KeysDown);
+		SerializeKeys(Ar, Input.KeysUp);
+		SerializeCharacters(Ar, Input.Characters);
+
+		if (Ar.IsLoading())
+		{
+			Input.DisplaySize = { DisplaySizeX, DisplaySizeY };
+			Input.MousePosition = { MousePositionX, MousePositionY };
+			Input.bHasMousePointer = (Flags & 1) != 0;
+			Input.bIsControlDown = (Flags & 2) != 0;
+			Input.bIsShiftDown = (Flags & 4) != 0;
+			Input.bIsAltDown = (Flags & 8) != 0;
+		}
+
+		return Ar;
+	}
+
+	TArray<uint8> MakeInput(FInput& Input)
+	{
+		TArray<uint8> Payload;
+		FMemoryWriter Writer(Payload);
+		Writer << Input;
+		return Payload;
+	}
+
+	bool ReadInput(const TArray<uint8>& Payload, FInput& OutInput)
+	{
+		FMemoryReader Reader(Payload);
+		Reader << OutInput;
+		return !Reader.IsError() && Reader.AtEnd();
+	}
+
+	void ApplyInput(const FInput& Input, FImGuiInputState& InputState)
+	{
+		InputState.SetMousePointer(Input.bHasMousePointer);
+		InputState.SetMousePosition(Input.MousePosition);
+		InputState.AddMouseWheelDelta(Input.MouseWheelDelta);
+
+		InputState.SetControlDown(Input.bIsControlDown);
+		InputState.SetShiftDown(Input.bIsShiftDown);
+		InputState.SetAltDown(Input.bIsAltDown);
+
+		auto SetKeyState = [&InputState](const FName& KeyName, bool bIsDown)
+		{
+			const FKey Key{ KeyName };
+			if (Key.IsMouseButton())
+			{
+				InputState.SetMouseDown(Key, bIsDown);
+			}
+			else if (Key.IsValid())
+			{
+				// Key events are keyed by key codes, which remote input doesn't have, so key index is used instead.
+				const uint32 KeyIndex = ImGuiInterops::GetKeyIndex(Key);
+				const FKeyEvent KeyEvent{ Key, FModifierKeysState{}, 0, false, 0, KeyIndex };
+
+				InputState.SetKeyDown(Key, bIsDown);
+				(bIsDown ? InputState.KeyDownEvents : InputState.KeyUpEvents).Add(KeyIndex, KeyEvent);
+			}
+		};
+
+		for (const FName& Key : Input.KeysDown)
+		{
+			SetKeyState(Key, true);
+		}
+		for (const FName& Key : Input.KeysUp)
+		{
+			SetKeyState(Key, false);
+		}
+
+		for (int32 Index = 0; Index < Input.Characters.Len(); Index++)
+		{
+			InputState.AddCharacter(Input.Characters[Index]);
+		}
+	}
+}
@@ -0,0 +1,207 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDrawData.h"
+
+#include <Containers/Array.h>
+#include <Containers/UnrealString.h>
+#include <Logging/LogMacros.h>
+#include <Math/Vector2D.h>
+#include <UObject/NameTypes.h>
+
+
+class FImGuiInputState;
+struct ImFontAtlas;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogImGuiRemote, Log, All);
+
+// Protocol used to stream ImGui output to remote clients. Every message starts with a header containing the payload
+// size, the message type and flags. Server sends font atlas after accepting a connection and then frames with draw data.
+// Frames are delta-encoded against the previous frame and compressed with LZ4. Clients send input back to the server.
+namespace ImGuiRemote
+{
+	// Port used when none is specified.
+	constexpr int32 DefaultPort = 7702;
+
+	// Version sent in the hello message. Client should disconnect, if it doesn't match.
+	constexpr uint32 ProtocolVersion = 3;
+
+	enum class EMessageType : uint8
+	{
+		Hello,
+		FontAtlas,
+		Frame,
+		Input
+	};
+
+	// Flags stored in the message header.
+	enum class EMessageFlags : uint8
+	{
+		None = 0,
+
+		// Data after the fixed part of the payload are compressed with LZ4.
+		Compressed = 1 << 0,
+
+		All = Compressed
+	};
+
+	// Size of the message header: payload size (uint32), message type (uint8) and message flags (uint8).
+	constexpr int32 HeaderSize = 6;
+
+	// Messages bigger than this are treated as a protocol error.
+	constexpr int32 MaxPayloadSize = 64 * 1024 * 1024;
+
+	// Data that would be bigger than this after decompression are treated as a protocol error (enough for a 4096x4096
+	// font atlas).
+	constexpr int32 MaxUncompressedSize = 64 * 1024 * 1024;
+
+	// Frames with more draw lists than this are treated as a protocol error.
+	constexpr int32 MaxDrawLists = 4096;
+
+	// Limits of the input message. Clients send at most this many keys in each of the key arrays and characters are
+	// truncated to this length. Received input exceeding these limits is treated as a protocol error.
+	constexpr int32 MaxInputKeys = 64;
+	constexpr int32 MaxInputCharacters = 256;
+
+	// Append a message to the buffer.
+	// @param Buffer - Buffer to which message should be appended
+	// @param Type - Message type
+	// @param Payload - Message payload
+	// @param bCompressed - Whether the payload contains compressed data
+	void WriteMessage(TArray<uint8>& Buffer, EMessageType Type, const TArray<uint8>& Payload, bool bCompressed);
+
+	// Try to read a complete message from the front of the buffer. Message is removed from the buffer.
+	// @param Buffer - Buffer with received data
+	// @param OutType - Type of the message that was read
+	// @param OutPayload - Payload of the message that was read
+	// @param bOutCompressed - Whether the payload contains compressed data
+	// @param bOutError - Set to true, if data in the buffer are invalid
+	// @returns True, if a complete message was read
+	bool ReadMessage(TArray<uint8>& Buffer, EMessageType& OutType, TArray<uint8>& OutPayload, bool& bOutCompressed, bool& bOutError);
+
+	// Create payload of the hello message.
+	TArray<uint8> MakeHello();
+
+	// Check whether payload of the hello message has a matching protocol version.
+	bool CheckHello(const TArray<uint8>& Payload);
+
+	// Create payload of the font atlas message with RGBA32 pixels of the atlas.
+	// @param FontAtlas - Font atlas with built texture data
+	// @param bOutCompressed - Whether pixels in the payload are compressed
+	// @returns Message payload
+	TArray<uint8> MakeFontAtlas(ImFontAtlas& FontAtlas, bool& bOutCompressed);
+
+	// Font atlas texture received from the server.
+	struct FFontAtlasTexture
+	{
+		int32 Width = 0;
+		int32 Height = 0;
+		TextureIndex Texture = INDEX_NONE;
+		TArray<uint8> Pixels;
+	};
+
+	// Read payload of the font atlas message.
+	// @param Payload - Message payload
+	// @param bCompressed - Whether the message header has the compressed flag
+	// @param OutFontAtlas - Read font atlas texture
+	// @returns True, if payload is valid
+	bool ReadFontAtlas(const TArray<uint8>& Payload, bool bCompressed, FFontAtlasTexture& OutFontAtlas);
+
+	// Information about an encoded frame.
+	struct FFrameInfo
+	{
+		uint32 FrameNumber = 0;
+
+		// Value of FPlatformTime::Seconds() at the moment of encoding (only comparable on the same machine).
+		double EncodeTime = 0.0;
+
+		FVector2D DisplaySize = FVector2D::ZeroVector;
+
+		int32 RawSize = 0;
+		int32 CompressedSize = 0;
+		bool bKeyFrame = false;
+
+		// Whether frame data are compressed (sent in the message header).
+		bool bCompressed = false;
+	};
+
+	// Encodes draw lists as frame payloads. Serialized frames are XOR-ed with the previous frame, which turns unchanged
+	// data into zeros that compress well. Because frames are sent over a reliable stream, every frame after the first one
+	// can be delta-encoded.
+	class FFrameEncoder
+	{
+	public:
+
+		// Encode a frame.
+		// @param Info - Frame information (sizes, the key frame and the compressed flags are updated)
+		// @param DrawLists - Draw lists to encode
+		// @param OutPayload - Frame message payload
+		void Encode(FFrameInfo& Info, const TArray<FImGuiDrawList>& DrawLists, TArray<uint8>& OutPayload);
+
+		// Forget the previous frame, so the next one is encoded as a key frame.
+		void Reset() { PreviousFrame.Reset(); }
+
+	private:
+
+		TArray<uint8> Frame;
+		TArray<uint8> PreviousFrame;
+		TArray<uint8> Delta;
+	};
+
+	// Decodes frame payloads created by FFrameEncoder.
+	class FFrameDecoder
+	{
+	public:
+
+		// Decode a frame.
+		// @param Payload - Frame message payload
+		// @param bCompressed - Whether the message header has the compressed flag
+		// @param OutInfo - Frame information
+		// @param OutDrawLists - Decoded draw lists
+		// @returns True, if frame was successfully decoded
+		bool Decode(const TArray<uint8>& Payload, bool bCompressed, FFrameInfo& OutInfo, TArray<FImGuiDrawList>& OutDrawLists);
+
+		// Forget the previous frame, so the next frame must be a key frame.
+		void Reset() { PreviousFrame.Reset(); }
+
+	private:
+
+		TArray<uint8> Frame;
+		TArray<uint8> PreviousFrame;
+	};
+
+	// Input state sent by client in one frame.
+	struct FInput
+	{
+		FVector2D DisplaySize = FVector2D::ZeroVector;
+		FVector2D MousePosition = FVector2D::ZeroVector;
+		float MouseWheelDelta = 0.f;
+
+		// Keyboard keys and mouse buttons that changed state, identified by key names. Only keys and buttons used by ImGui
+		// are sent; others are ignored.
+		TArray<FName> KeysDown;
+		TArray<FName> KeysUp;
+
+		FString Characters;
+
+		bool bHasMousePointer = false;
+		bool bIsControlDown = false;
+		bool bIsShiftDown = false;
+		bool bIsAltDown = false;
+
+		friend FArchive& operator<<(FArchive& Ar, FInput& Input);
+	};
+
+	// Create payload of the input message.
+	TArray<uint8> MakeInput(FInput& Input);
+
+	// Read payload of the input message.
+	// @returns True, if payload is valid and within input limits
+	bool ReadInput(const TArray<uint8>& Payload, FInput& OutInput);
+
+	// Apply received input to the input state of a context.
+	// @param Input - Received input
+	// @param InputState - Input state to update
+	void ApplyInput(const FInput& Input, FImGuiInputState& InputState);
+}
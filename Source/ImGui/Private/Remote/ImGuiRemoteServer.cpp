@@ -0,0 +1,299 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "ImGuiRemoteServer.h"
+
+#include "ImGuiContextManager.h"
+#include "ImGuiContextProxy.h"
+#include "ImGuiRemoteClient.h"
+#include "Utilities/WorldContextIndex.h"
+
+#include <Common/TcpSocketBuilder.h>
+#include <Engine/Engine.h>
+#include <HAL/PlatformTime.h>
+#include <Interfaces/IPv4/IPv4Address.h>
+#include <Sockets.h>
+#include <SocketSubsystem.h>
+
+
+namespace
+{
+	// Context streamed when none is specified: the first game world or the editor, if there are no game worlds.
+	int32 GetDefaultContextIndex()
+	{
+#if WITH_EDITOR
+		if (GEngine)
+		{
+			for (const FWorldContext& WorldContext : GEngine->GetWorldContexts())
+			{
+				if (WorldContext.WorldType == EWorldType::PIE || WorldContext.WorldType == EWorldType::Game)
+				{
+					return Utilities::GetWorldContextIndex(WorldContext);
+				}
+			}
+		}
+		return Utilities::EDITOR_CONTEXT_INDEX;
+#else
+		return Utilities::STANDALONE_GAME_CONTEXT_INDEX;
+#endif // WITH_EDITOR
+	}
+}
+
+FImGuiRemoteServer::FImGuiRemoteServer(FImGuiContextManager& InContextManager)
+	: ContextManager(InContextManager)
+	, StartCommand(TEXT("ImGui.Remote.Start"),
+		TEXT("Start streaming ImGui output to a remote client. Arguments: [Port] [ContextIndex] [AnyAddress]"),
+		FConsoleCommandWithArgsDelegate::CreateRaw(this, &FImGuiRemoteServer::StartImpl))
+	, StopCommand(TEXT("ImGui.Remote.Stop"),
+		TEXT("Stop streaming ImGui output and disconnect remote client."),
+		FConsoleCommandDelegate::CreateRaw(this, &FImGuiRemoteServer::StopImpl))
+	, TestClientCommand(TEXT("ImGui.Remote.TestClient"),
+		TEXT("Connect a test client, which decodes frames and reports bandwidth and latency. Arguments: [Seconds] [Address] [Port]"),
+		FConsoleCommandWithArgsDelegate::CreateRaw(this, &FImGuiRemoteServer::TestClientImpl))
+{
+	ContextManager.GetFontAtlasCache().OnFontAtlasReady.AddRaw(this, &FImGuiRemoteServer::OnFontAtlasReady);
+}
+
+FImGuiRemoteServer::~FImGuiRemoteServer()
+{
+	ContextManager.GetFontAtlasCache().OnFontAtlasReady.RemoveAll(this);
+
+	TestClient.Client.Reset();
+	Stop();
+}
+
+bool FImGuiRemoteServer::Start(int32 Port, int32 InContextIndex, bool bListenOnAnyAddress)
+{
+	Stop();
+
+	// Clients are not authenticated and can send input to the game, so by default only local ones are accepted.
+	const FIPv4Address Address = bListenOnAnyAddress ? FIPv4Address::Any : FIPv4Address(127, 0, 0, 1);
+
+	ListenSocket = FTcpSocketBuilder(TEXT("ImGuiRemoteServer"))
+		.AsNonBlocking()
+		.AsReusable()
+		.BoundToAddress(Address)
+		.BoundToPort(Port)
+		.Listening(1)
+		.Build();
+
+	if (!ListenSocket)
+	{
+		UE_LOG(LogImGuiRemote, Warning, TEXT("Couldn't listen on %s:%d."), *Address.ToString(), Port);
+		return false;
+	}
+
+	ListenPort = Port;
+	ContextIndex = InContextIndex;
+
+	if (bListenOnAnyAddress)
+	{
+		UE_LOG(LogImGuiRemote, Warning, TEXT("Streaming ImGui context %d on port %d of all network interfaces. Any client ")
+			TEXT("that can reach this machine can control ImGui."), ContextIndex, ListenPort);
+	}
+	else
+	{
+		UE_LOG(LogImGuiRemote, Log, TEXT("Streaming ImGui context %d on %s:%d."), ContextIndex, *Address.ToString(), ListenPort);
+	}
+	return true;
+}
+
+void FImGuiRemoteServer::Stop()
+{
+	Connection.Reset();
+
+	if (ListenSocket)
+	{
+		ListenSocket->Close();
+		ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->DestroySocket(ListenSocket);
+		ListenSocket = nullptr;
+	}
+}
+
+void FImGuiRemoteServer::Tick()
+{
+	if (ListenSocket)
+	{
+		AcceptConnection();
+
+		if (Connection.IsValid())
+		{
+			Connection->Flush();
+			Connection->Receive();
+			ReceiveInput();
+
+			// Encode a new frame only when the previous one was sent.
+			if (Connection->IsOpen() && !Connection->HasPendingSend())
+			{
+				SendFrame();
+				Connection->Flush();
+			}
+
+			if (!Connection->IsOpen())
+			{
+				UE_LOG(LogImGuiRemote, Log, TEXT("Remote client disconnected."));
+				Connection.Reset();
+			}
+		}
+	}
+
+	TickTestClient();
+}
+
+void FImGuiRemoteServer::OnFontAtlasReady(FImGuiFontAtlas& FontAtlas)
+{
+	// New atlases may be allocated at addresses of released ones, so we don't rely only on comparing pointers.
+	bFontAtlasDirty = true;
+}
+
+void FImGuiRemoteServer::AcceptConnection()
+{
+	bool bHasPendingConnection = false;
+	if (ListenSocket->HasPendingConnection(bHasPendingConnection) && bHasPendingConnection)
+	{
+		if (FSocket* Socket = ListenSocket->Accept(TEXT("ImGuiRemoteClient")))
+		{
+			// Only one client is supported, so a new client replaces the previous one.
+			Connection = MakeUnique<ImGuiRemote::FConnection>(Socket);
+			Connection->Send(ImGuiRemote::EMessageType::Hello, ImGuiRemote::MakeHello());
+
+			// A new client needs font atlas and a key frame.
+			Encoder.Reset();
+			bFontAtlasDirty = true;
+
+			UE_LOG(LogImGuiRemote, Log, TEXT("Remote client connected."));
+		}
+	}
+}
+
+void FImGuiRemoteServer::ReceiveInput()
+{
+	FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(ContextIndex);
+
+	ImGuiRemote::EMessageType Type;
+	TArray<uint8> Payload;
+	bool bCompressed;
+	while (Connection->ReadMessage(Type, Payload, bCompressed))
+	{
+		if (Type == ImGuiRemote::EMessageType::Hello && !ImGuiRemote::CheckHello(Payload))
+		{
+			UE_LOG(LogImGuiRemote, Warning, TEXT("Remote client uses a different protocol version. Disconnecting."));
+			Connection->Close();
+		}
+		else if (Type == ImGuiRemote::EMessageType::Input && ContextProxy)
+		{
+			ImGuiRemote::FInput Input;
+			if (ImGuiRemote::ReadInput(Payload, Input))
+			{
+				ImGuiRemote::ApplyInput(Input, ContextProxy->GetInputState());
+
+				// Client display defines the canvas size.
+				if (Input.DisplaySize.X > 0.f && Input.DisplaySize.Y > 0.f)
+				{
+					ContextProxy->SetDisplaySize(Input.DisplaySize);
+				}
+			}
+		}
+	}
+}
+
+void FImGuiRemoteServer::SendFrame()
+{
+	const FImGuiContextProxy* ContextProxy = ContextManager.GetContextProxy(ContextIndex);
+	if (!ContextProxy)
+	{
+		return;
+	}
+
+	// Contexts switch atlases when their DPI scale changes, so we also need to check which one is used.
+	FImGuiFontAtlas& FontAtlas = ContextProxy->GetFontAtlas();
+	if (bFontAtlasDirty || &FontAtlas != SentFontAtlas)
+	{
+		bool bCompressed = false;
+		const TArray<uint8> FontAtlasPayload = ImGuiRemote::MakeFontAtlas(FontAtlas.GetAtlas(), bCompressed);
+		Connection->Send(ImGuiRemote::EMessageType::FontAtlas, FontAtlasPayload, bCompressed);
+		SentFontAtlas = &FontAtlas;
+		bFontAtlasDirty = false;
+	}
+
+	ImGuiRemote::FFrameInfo Info;
+	Info.FrameNumber = GFrameNumber;
+	Info.EncodeTime = FPlatformTime::Seconds();
+	Info.DisplaySize = ContextProxy->GetDisplaySize();
+
+	Encoder.Encode(Info, ContextProxy->GetDrawData(), FramePayload);
+	Connection->Send(ImGuiRemote::EMessageType::Frame, FramePayload, Info.bCompressed);
+}
+
+void FImGuiRemoteServer::TickTestClient()
+{
+	if (!TestClient.Client.IsValid())
+	{
+		return;
+	}
+
+	const double Time = FPlatformTime::Seconds() - TestClient.StartTime;
+
+	// Move mouse in a circle, so the input path is exercised and output changes between frames.
+	ImGuiRemote::FInput Input;
+	Input.bHasMousePointer = true;
+	Input.MousePosition = FVector2D(400.0 + 200.0 * FMath::Cos(Time), 300.0 + 200.0 * FMath::Sin(Time));
+	TestClient.Client->SendInput(Input);
+
+	TestClient.Client->Tick();
+
+	if (Time >= TestClient.Duration || !TestClient.Client->IsConnected())
+	{
+		ReportTestClient();
+		TestClient.Client.Reset();
+	}
+}
+
+void FImGuiRemoteServer::ReportTestClient()
+{
+	const FImGuiRemoteClient::FStats& Stats = TestClient.Client->GetStats();
+	const double Time = FMath::Max(FPlatformTime::Seconds() - TestClient.StartTime, 0.001);
+	const int32 NumFrames = FMath::Max(Stats.NumFrames, 1);
+
+	UE_LOG(LogImGuiRemote, Display, TEXT("Remote test client: %d frames (%d key frames, %d errors) in %.2f s, %.1f frames/s."),
+		Stats.NumFrames, Stats.NumKeyFrames, Stats.NumErrors, Time, Stats.NumFrames / Time);
+	UE_LOG(LogImGuiRemote, Display, TEXT("Remote test client: received %.1f KB/s, average frame %.1f KB raw and %.1f KB compressed (%.1f%%)."),
+		TestClient.Client->GetBytesReceived() / Time / 1024.0, Stats.RawBytes / 1024.0 / NumFrames,
+		Stats.CompressedBytes / 1024.0 / NumFrames, Stats.RawBytes > 0 ? 100.0 * Stats.CompressedBytes / Stats.RawBytes : 0.0);
+	UE_LOG(LogImGuiRemote, Display, TEXT("Remote test client: latency %.3f ms average, %.3f ms max."),
+		Stats.TotalLatency * 1000.0 / NumFrames, Stats.MaxLatency * 1000.0);
+}
+
+void FImGuiRemoteServer::StartImpl(const TArray<FString>& Args)
+{
+	// Listening on all interfaces needs to be requested explicitly and can be combined with other arguments.
+	TArray<FString> NumericArgs = Args;
+	const bool bListenOnAnyAddress = NumericArgs.RemoveAll([](const FString& Arg) { return Arg.Equals(TEXT("AnyAddress"), ESearchCase::IgnoreCase); }) > 0;
+
+	const int32 Port = NumericArgs.Num() > 0 ? FCString::Atoi(*NumericArgs[0]) : ImGuiRemote::DefaultPort;
+	const int32 Index = NumericArgs.Num() > 1 ? FCString::Atoi(*NumericArgs[1]) : GetDefaultContextIndex();
+	Start(Port, Index, bListenOnAnyAddress);
+}
+
+void FImGuiRemoteServer::StopImpl()
+{
+	Stop();
+}
+
+void FImGuiRemoteServer::TestClientImpl(const TArray<FString>& Args)
+{
+	const double Duration = Args.Num() > 0 ? FCString::Atod(*Args[0]) : 5.0;
+	const FString Address = Args.Num() > 1 ? Args[1] : TEXT("127.0.0.1");
+	const int32 Port = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : ListenPort;
+
+	TestClient.Client = MakeUnique<FImGuiRemoteClient>();
+	if (TestClient.Client->Connect(Address, Port))
+	{
+		TestClient.StartTime = FPlatformTime::Seconds();
+		TestClient.Duration = Duration;
+	}
+	else
+	{
+		UE_LOG(LogImGuiRemote, Warning, TEXT("Test client couldn't connect. Use ImGui.Remote.Start to start the server."));
+		TestClient.Client.Reset();
+	}
+}
@@ -0,0 +1,100 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiRemoteConnection.h"
+#include "ImGuiRemoteProtocol.h"
+
+#include <HAL/IConsoleManager.h>
+#include <Templates/UniquePtr.h>
+
+
+class FImGuiContextManager;
+class FImGuiFontAtlas;
+class FImGuiRemoteClient;
+class FSocket;
+
+// Streams output of one ImGui context to a remote client over TCP and feeds input received from that client back to
+// the context. This allows to use ImGui in builds without viewports, like dedicated servers. Only one client can be
+// connected at a time. New frames are only encoded after the previous one was sent, so slow connections reduce the
+// frame rate instead of accumulating latency.
+//
+// Console commands:
+//   ImGui.Remote.Start [Port] [ContextIndex] [AnyAddress] - Start listening (by default streams the first game world
+//     context and accepts only local clients; AnyAddress listens on all network interfaces)
+//   ImGui.Remote.Stop - Stop listening and disconnect client
+//   ImGui.Remote.TestClient [Seconds] [Address] [Port] - Connect a test client and report bandwidth and latency
+class FImGuiRemoteServer
+{
+public:
+
+	FImGuiRemoteServer(FImGuiContextManager& InContextManager);
+	~FImGuiRemoteServer();
+
+	FImGuiRemoteServer(const FImGuiRemoteServer&) = delete;
+	FImGuiRemoteServer& operator=(const FImGuiRemoteServer&) = delete;
+
+	FImGuiRemoteServer(FImGuiRemoteServer&&) = delete;
+	FImGuiRemoteServer& operator=(FImGuiRemoteServer&&) = delete;
+
+	// Start listening for clients. Clients are not authenticated and can control ImGui, so by default the server only
+	// listens on the loopback interface.
+	// @param Port - Port on which server should listen
+	// @param InContextIndex - Index of the context to stream
+	// @param bListenOnAnyAddress - Whether to accept clients from all network interfaces
+	// @returns True, if server is listening
+	bool Start(int32 Port, int32 InContextIndex, bool bListenOnAnyAddress = false);
+
+	// Stop listening and disconnect the client.
+	void Stop();
+
+	// Whether server is listening for clients.
+	bool IsRunning() const { return ListenSocket != nullptr; }
+
+	// Exchange data with the connected client. Should be called after contexts are ticked, so the last frame can be sent.
+	void Tick();
+
+private:
+
+	// State of the test client started with a console command.
+	struct FTestClient
+	{
+		TUniquePtr<FImGuiRemoteClient> Client;
+		double StartTime = 0.0;
+		double Duration = 0.0;
+	};
+
+	void OnFontAtlasReady(FImGuiFontAtlas& FontAtlas);
+
+	void AcceptConnection();
+	void ReceiveInput();
+	void SendFrame();
+
+	void TickTestClient();
+	void ReportTestClient();
+
+	void StartImpl(const TArray<FString>& Args);
+	void StopImpl();
+	void TestClientImpl(const TArray<FString>& Args);
+
+	FImGuiContextManager& ContextManager;
+
+	FSocket* ListenSocket = nullptr;
+	TUniquePtr<ImGuiRemote::FConnection> Connection;
+
+	int32 ListenPort = ImGuiRemote::DefaultPort;
+	int32 ContextIndex = 0;
+
+	ImGuiRemote::FFrameEncoder Encoder;
+	TArray<uint8> FramePayload;
+
+	// Atlas last sent to the client.
+	const FImGuiFontAtlas* SentFontAtlas = nullptr;
+	bool bFontAtlasDirty = true;
+
+	FTestClient TestClient;
+
+	FAutoConsoleCommand StartCommand;
+	FAutoConsoleCommand StopCommand;
+	FAutoConsoleCommand TestClientCommand;
+};
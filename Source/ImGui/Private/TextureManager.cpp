@@ -8,6 +8,21 @@
 #include <algorithm>
 
 
+namespace
+{
+	// Copy data to a texture. Copying is done in the render thread, so data cleanup is called asynchronously.
+	void UpdateTextureData(UTexture2D* Texture, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup)
+	{
+		FUpdateTextureRegion2D* TextureRegion = new FUpdateTextureRegion2D(0, 0, 0, 0, Width, Height);
+		auto DataCleanup = [SrcDataCleanup](uint8* Data, const FUpdateTextureRegion2D* UpdateRegion)
+		{
+			SrcDataCleanup(Data);
+			delete UpdateRegion;
+		};
+		Texture->UpdateTextureRegions(0, 1u, TextureRegion, SrcBpp * Width, SrcBpp, SrcData, DataCleanup);
+	}
+}
+
 void FTextureManager::InitializeErrorTexture(const FColor& Color)
 {
 	CreatePlainTextureInternal(NAME_ErrorTexture, 2, 2, Color);
@@ -27,6 +42,31 @@ TextureIndex FTextureManager::CreatePlainTexture(const FName& Name, int32 Width,
 	return CreatePlainTextureInternal(Name, Width, Height, Color);
 }
 
+TextureIndex FTextureManager::UpdateDynamicTexture(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup)
+{
+	checkf(Name != NAME_None, TEXT("Trying to update a texture with a name 'NAME_None' is not allowed."));
+
+	// Update existing texture, if size didn't change.
+	const TextureIndex Index = FindTextureIndex(Name);
+	if (Index != INDEX_NONE)
+	{
+		UTexture2D* Texture = Cast<UTexture2D>(TextureResources[Index].GetOwnedTexture());
+		if (Texture && Texture->GetSizeX() == Width && Texture->GetSizeY() == Height)
+		{
+			UpdateTextureData(Texture, Width, Height, SrcBpp, SrcData, SrcDataCleanup);
+			return Index;
+		}
+	}
+
+	// Create a new texture (replacing the old entry, if there was one).
+	UTexture2D* Texture = UTexture2D::CreateTransient(Width, Height);
+	Texture->Filter = TF_Nearest;
+	Texture->UpdateResource();
+	UpdateTextureData(Texture, Width, Height, SrcBpp, SrcData, SrcDataCleanup);
+
+	return AddTextureEntry(Name, Texture, true);
+}
+
 TextureIndex FTextureManager::CreateTextureResources(const FName& Name, UTexture* Texture)
 {
 	checkf(Name != NAME_None, TEXT("Trying to create texture resources with a name 'NAME_None' is not allowed."));
@@ -52,13 +92,7 @@ TextureIndex FTextureManager::CreateTextureInternal(const FName& Name, int32 Wid
 	Texture->UpdateResource();
 
 	// Update texture data.
-	FUpdateTextureRegion2D* TextureRegion = new FUpdateTextureRegion2D(0, 0, 0, 0, Width, Height);
-	auto DataCleanup = [SrcDataCleanup](uint8* Data, const FUpdateTextureRegion2D* UpdateRegion)
-	{
-		SrcDataCleanup(Data);
-		delete UpdateRegion;
-	};
-	Texture->UpdateTextureRegions(0, 1u, TextureRegion, SrcBpp * Width, SrcBpp, SrcData, DataCleanup);
+	UpdateTextureData(Texture, Width, Height, SrcBpp, SrcData, SrcDataCleanup);
 
 	// Create an entry for the texture.
 	if (Name == NAME_ErrorTexture)
@@ -80,6 +80,17 @@ public:
 	// @returns The index of a texture that was created
 	TextureIndex CreatePlainTexture(const FName& Name, int32 Width, int32 Height, FColor Color);
 
+	// Create or update a dynamic texture from raw data. If a texture with that name exists and has the same size, it is
+	// updated in place, otherwise a new texture is created. Dynamic textures use nearest filtering.
+	// @param Name - The texture name
+	// @param Width - The texture width
+	// @param Height - The texture height
+	// @param SrcBpp - The size in bytes of one pixel
+	// @param SrcData - The source data
+	// @param SrcDataCleanup - Optional function called to release source data after texture is updated (only needed, if data need to be released)
+	// @returns The index of a texture that was created or updated
+	TextureIndex UpdateDynamicTexture(const FName& Name, int32 Width, int32 Height, uint32 SrcBpp, uint8* SrcData, TFunction<void(uint8*)> SrcDataCleanup = [](uint8*) {});
+
 	// Create Slate resources to an existing texture, managed externally.
 	// @param Name - The texture name
 	// @param Texture - The texture
@@ -140,6 +151,9 @@ private:
 		const FName& GetName() const { return Name; }
 		const FSlateResourceHandle& GetResourceHandle() const;
 
+		// Get texture owned by this entry, or null if texture is managed externally.
+		UTexture* GetOwnedTexture() const { return Texture.Get(); }
+
 	private:
 
 		void Reset(bool bReleaseResources);
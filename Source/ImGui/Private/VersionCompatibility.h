@@ -28,6 +28,9 @@
 // to call debug delegates after world actors are already updated.
 #define ENGINE_COMPATIBILITY_WITH_WORLD_POST_ACTOR_TICK FROM_ENGINE_VERSION(4, 18)
 
+// Starting from version 4.18, DPI of monitors can be read with FPlatformApplicationMisc (ApplicationCore module).
+#define ENGINE_COMPATIBILITY_WITH_MONITOR_DPI           FROM_ENGINE_VERSION(4, 18)
+
 // Starting from version 4.24, world actor tick event has additional world parameter.
 #define ENGINE_COMPATIBILITY_LEGACY_WORLD_ACTOR_TICK    BELOW_ENGINE_VERSION(4, 24)
 
@@ -35,3 +38,9 @@
 #define ENGINE_COMPATIBILITY_LEGACY_KEY_AXIS_API        BELOW_ENGINE_VERSION(4, 26)
 
 #define ENGINE_COMPATIBILITY_LEGACY_VECTOR2F            BELOW_ENGINE_VERSION(5, 0)
+
+// Starting from version 5.0, ULocalPlayer::GetProjectionData takes a stereo view index instead of a stereoscopic pass.
+#define ENGINE_COMPATIBILITY_LEGACY_STEREO_PASS         BELOW_ENGINE_VERSION(5, 0)
+
+// Starting from version 5.0, FTicker is deprecated and replaced with thread-safe FTSTicker.
+#define ENGINE_COMPATIBILITY_LEGACY_CORE_TICKER         BELOW_ENGINE_VERSION(5, 0)
@@ -0,0 +1,47 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#include "SImGuiDrawDataWidget.h"
+
+#include "ImGuiContextManager.h"
+#include "ImGuiContextProxy.h"
+#include "ImGuiModuleManager.h"
+
+#include <SlateOptMacros.h>
+
+
+BEGIN_SLATE_FUNCTION_BUILD_OPTIMIZATION
+void SImGuiDrawDataWidget::Construct(const FArguments& InArgs)
+{
+	checkf(InArgs._ModuleManager, TEXT("Null Module Manager argument"));
+
+	ModuleManager = InArgs._ModuleManager;
+	ContextIndex = InArgs._ContextIndex;
+}
+END_SLATE_FUNCTION_BUILD_OPTIMIZATION
+
+FVector2D SImGuiDrawDataWidget::ComputeDesiredSize(float InScale) const
+{
+	const FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex);
+	return ContextProxy ? ContextProxy->GetDisplaySize() * InScale : FVector2D::ZeroVector;
+}
+
+int32 SImGuiDrawDataWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect,
+	FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const
+{
+	if (const FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+	{
+		const FVector2D& DisplaySize = ContextProxy->GetDisplaySize();
+		if (DisplaySize.X > 0.f && DisplaySize.Y > 0.f)
+		{
+			// Scale the context display area to fit in the widget, keeping its aspect ratio to avoid distorting text.
+			const FVector2D Scale = AllottedGeometry.GetLocalSize() / DisplaySize;
+			const FSlateRenderTransform ImGuiToWidget{ static_cast<float>(FMath::Min(Scale.X, Scale.Y)) };
+			const FSlateRenderTransform ImGuiToScreen = ImGuiToWidget.Concatenate(AllottedGeometry.GetAccumulatedRenderTransform());
+
+			Painter.Paint(ContextProxy->GetDrawData(), ImGuiToScreen, MyCullingRect, ModuleManager->GetTextureManager(),
+				OutDrawElements, LayerId);
+		}
+	}
+
+	return LayerId;
+}
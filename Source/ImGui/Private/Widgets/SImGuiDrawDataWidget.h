@@ -0,0 +1,48 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include "ImGuiDrawListPainter.h"
+
+#include <Widgets/DeclarativeSyntaxSupport.h>
+#include <Widgets/SLeafWidget.h>
+
+
+class FImGuiModuleManager;
+
+// Leaf widget that paints the last draw data of an ImGui context, scaling the whole context display area to fit in
+// the allotted geometry. Unlike SImGuiWidget, it doesn't tick the context and it doesn't handle input, so it can be used
+// to render ImGui output outside of game viewports.
+class SImGuiDrawDataWidget : public SLeafWidget
+{
+	typedef SLeafWidget Super;
+
+public:
+
+	SLATE_BEGIN_ARGS(SImGuiDrawDataWidget)
+	{}
+	SLATE_ARGUMENT(FImGuiModuleManager*, ModuleManager)
+	SLATE_ARGUMENT(int32, ContextIndex)
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs);
+
+	// Get index of the context that this widget is painting.
+	int32 GetContextIndex() const { return ContextIndex; }
+
+	//----------------------------------------------------------------------------------------------------
+	// SWidget overrides
+	//----------------------------------------------------------------------------------------------------
+
+	virtual FVector2D ComputeDesiredSize(float InScale) const override;
+
+	virtual int32 OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeometry, const FSlateRect& MyCullingRect, FSlateWindowElementList& OutDrawElements, int32 LayerId, const FWidgetStyle& InWidgetStyle, bool bParentEnabled) const override;
+
+private:
+
+	FImGuiModuleManager* ModuleManager = nullptr;
+
+	int32 ContextIndex = 0;
+
+	mutable FImGuiDrawListPainter Painter;
+};
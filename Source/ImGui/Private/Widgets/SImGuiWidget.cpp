@@ -5,6 +5,7 @@
 
 #include "ImGuiContextManager.h"
 #include "ImGuiContextProxy.h"
+#include "ImGuiDrawListPainter.h"
 #include "ImGuiInputHandler.h"
 #include "ImGuiInputHandlerFactory.h"
 #include "ImGuiInteroperability.h"
@@ -19,6 +20,10 @@
 #include <Engine/LocalPlayer.h>
 #include <Framework/Application/SlateApplication.h>
 #include <GameFramework/GameUserSettings.h>
+#if ENGINE_COMPATIBILITY_WITH_MONITOR_DPI
+#include <HAL/PlatformApplicationMisc.h>
+#endif
+#include <SceneView.h>
 #include <SlateOptMacros.h>
 #include <Widgets/SViewport.h>
 
@@ -153,6 +158,8 @@ void SImGuiWidget::Tick(const FGeometry& AllottedGeometry, const double InCurren
 	UpdateTransparentMouseInput(AllottedGeometry);
 	HandleWindowFocusLost();
 	UpdateCanvasSize();
+	UpdateMonitorDPIScale(AllottedGeometry);
+	UpdateWorldOverlayView(AllottedGeometry);
 }
 
 FReply SImGuiWidget::OnKeyChar(const FGeometry& MyGeometry, const FCharacterEvent& CharacterEvent)
@@ -543,6 +550,44 @@ void SImGuiWidget::SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo)
 		DPIScale = Scale;
 		bUpdateCanvasSize = true;
 	}
+
+	// When scaling in Slate, monitor DPI is already applied to the whole window.
+	bScaleWithMonitorDPI = !ScaleInfo.ShouldScaleInSlate();
+	bUpdateMonitorDPIScale = true;
+}
+
+void SImGuiWidget::UpdateMonitorDPIScale(const FGeometry& AllottedGeometry)
+{
+#if ENGINE_COMPATIBILITY_WITH_MONITOR_DPI
+	// Monitor can only change when the widget moves, so we don't need to query DPI in every frame.
+	const FVector2D Center = AllottedGeometry.LocalToAbsolute(AllottedGeometry.GetLocalSize() * 0.5f);
+	if (bUpdateMonitorDPIScale || Center != MonitorDPIPosition)
+	{
+		bUpdateMonitorDPIScale = false;
+		MonitorDPIPosition = Center;
+
+		// Scale from settings is calculated for the primary display, so we only apply the relative DPI of the monitor
+		// on which this widget is displayed.
+		float Factor = 1.f;
+		if (bScaleWithMonitorDPI && FSlateApplication::IsInitialized())
+		{
+			FDisplayMetrics DisplayMetrics;
+			FSlateApplication::Get().GetInitialDisplayMetrics(DisplayMetrics);
+			const FPlatformRect& PrimaryArea = DisplayMetrics.PrimaryDisplayWorkAreaRect;
+
+			const float PrimaryDPIScale = FPlatformApplicationMisc::GetDPIScaleFactorAtPoint(
+				(PrimaryArea.Left + PrimaryArea.Right) / 2, (PrimaryArea.Top + PrimaryArea.Bottom) / 2);
+			const float MonitorDPIScale = FPlatformApplicationMisc::GetDPIScaleFactorAtPoint(Center.X, Center.Y);
+
+			if (PrimaryDPIScale > 0.f && MonitorDPIScale > 0.f)
+			{
+				Factor = MonitorDPIScale / PrimaryDPIScale;
+			}
+		}
+
+		ModuleManager->GetContextManager().SetContextDPIScaleFactor(ContextIndex, Factor);
+	}
+#endif // ENGINE_COMPATIBILITY_WITH_MONITOR_DPI
 }
 
 void SImGuiWidget::SetCanvasSizeInfo(const FImGuiCanvasSizeInfo& CanvasSizeInfo)
@@ -607,6 +652,57 @@ void SImGuiWidget::UpdateCanvasSize()
 	}
 }
 
+void SImGuiWidget::UpdateWorldOverlayView(const FGeometry& AllottedGeometry)
+{
+	if (FImGuiContextProxy* ContextProxy = ModuleManager->GetContextManager().GetContextProxy(ContextIndex))
+	{
+		FImGuiWorldOverlayBatch& WorldOverlay = ContextProxy->GetWorldOverlay();
+
+		ULocalPlayer* LocalPlayer = GetLocalPlayer();
+		FViewport* Viewport = GameViewport.IsValid() ? GameViewport->Viewport : nullptr;
+
+		FSceneViewProjectionData ProjectionData;
+#if ENGINE_COMPATIBILITY_LEGACY_STEREO_PASS
+		const bool bHasProjection = LocalPlayer && Viewport && LocalPlayer->GetProjectionData(Viewport, eSSP_FULL, ProjectionData);
+#else
+		const bool bHasProjection = LocalPlayer && Viewport && LocalPlayer->GetProjectionData(Viewport, ProjectionData);
+#endif
+
+		FVector2D ViewportSize = FVector2D::ZeroVector;
+		if (bHasProjection)
+		{
+			GameViewport->GetViewportSize(ViewportSize);
+		}
+
+		if (ViewportSize.X > 0.f && ViewportSize.Y > 0.f)
+		{
+			// Normalized device coordinates are mapped to the view rectangle in the viewport, which is then mapped to
+			// this widget and to the ImGui canvas. All those transformations are linear, so we can pass them as scale
+			// and offset.
+			const FIntRect ViewRect = ProjectionData.GetConstrainedViewRect();
+			const FVector2D ViewportToLocal = AllottedGeometry.GetLocalSize() / ViewportSize;
+			const FSlateRenderTransform LocalToImGui = ImGuiTransform.Inverse();
+
+			auto NDCToImGui = [&](float X, float Y)
+			{
+				const FVector2D ViewportPoint{ ViewRect.Min.X + (0.5f + 0.5f * X) * ViewRect.Width(),
+					ViewRect.Min.Y + (0.5f - 0.5f * Y) * ViewRect.Height() };
+				return FVector2D{ LocalToImGui.TransformPoint(ViewportPoint * ViewportToLocal) };
+			};
+
+			const FVector2D Offset = NDCToImGui(0.f, 0.f);
+			const FVector2D Scale = NDCToImGui(1.f, 1.f) - Offset;
+
+			WorldOverlay.SetView(ProjectionData.ViewOrigin, ProjectionData.ViewRotationMatrix * ProjectionData.ProjectionMatrix,
+				Scale, Offset);
+		}
+		else
+		{
+			WorldOverlay.ResetView();
+		}
+	}
+}
+
 void SImGuiWidget::UpdateCanvasControlMode(const FInputEvent& InputEvent)
 {
 	if (bCanvasControlEnabled)
@@ -641,47 +737,8 @@ int32 SImGuiWidget::OnPaint(const FPaintArgs& Args, const FGeometry& AllottedGeo
 		const FSlateRenderTransform& WidgetToScreen = AllottedGeometry.GetAccumulatedRenderTransform();
 		const FSlateRenderTransform ImGuiToScreen = RoundTranslation(ImGuiRenderTransform.Concatenate(WidgetToScreen));
 
-#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-		// Convert clipping rectangle to format required by Slate vertex.
-		const FSlateRotatedRect VertexClippingRect{ MyClippingRect };
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-
-		for (const auto& DrawList : ContextProxy->GetDrawData())
-		{
-#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-			DrawList.CopyVertexData(VertexBuffer, ImGuiToScreen, VertexClippingRect);
-#else
-			DrawList.CopyVertexData(VertexBuffer, ImGuiToScreen);
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-
-			for (int CommandNb = 0; CommandNb < DrawList.NumCommands(); CommandNb++)
-			{
-				const auto& DrawCommand = DrawList.GetCommand(CommandNb, ImGuiToScreen);
-
-				DrawList.CopyIndexData(IndexBuffer, DrawCommand.IndexOffset, DrawCommand.NumElements);
-
-				// Get texture resource handle for this draw command (null index will be also mapped to a valid texture).
-				const FSlateResourceHandle& Handle = ModuleManager->GetTextureManager().GetTextureHandle(DrawCommand.TextureId);
-
-				// Transform clipping rectangle to screen space and apply to elements that we draw.
-				const FSlateRect ClippingRect = DrawCommand.ClippingRect.IntersectionWith(MyClippingRect);
-
-#if ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-				// Get access to the Slate scissor rectangle defined in Slate Core API, so we can customize elements drawing.
-				extern SLATECORE_API TOptional<FShortRect> GSlateScissorRect;
-				TGuardValue<TOptional<FShortRect>> GSlateScissorRecGuard(GSlateScissorRect, FShortRect{ ClippingRect });
-#else
-				OutDrawElements.PushClip(FSlateClippingZone{ ClippingRect });
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-
-				// Add elements to the list.
-				FSlateDrawElement::MakeCustomVerts(OutDrawElements, LayerId, Handle, VertexBuffer, IndexBuffer, nullptr, 0, 0);
-
-#if !ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-				OutDrawElements.PopClip();
-#endif // ENGINE_COMPATIBILITY_LEGACY_CLIPPING_API
-			}
-		}
+		Painter.Paint(ContextProxy->GetDrawData(), ImGuiToScreen, MyClippingRect, ModuleManager->GetTextureManager(),
+			OutDrawElements, LayerId);
 	}
 
 	return Super::OnPaint(Args, AllottedGeometry, MyClippingRect, OutDrawElements, LayerId, WidgetStyle, bParentEnabled);
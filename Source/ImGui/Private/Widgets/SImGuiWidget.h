@@ -2,6 +2,7 @@
 
 #pragma once
 
+#include "ImGuiDrawListPainter.h"
 #include "ImGuiModuleDebug.h"
 #include "ImGuiModuleSettings.h"
 
@@ -111,9 +112,15 @@ private:
 
 	void SetDPIScale(const FImGuiDPIScaleInfo& ScaleInfo);
 
+	// Update DPI scale factor of the context, if the widget moved to a monitor with a different DPI.
+	void UpdateMonitorDPIScale(const FGeometry& AllottedGeometry);
+
 	void SetCanvasSizeInfo(const FImGuiCanvasSizeInfo& CanvasSizeInfo);
 	void UpdateCanvasSize();
 
+	// Update view used to project world overlay primitives to ImGui space.
+	void UpdateWorldOverlayView(const FGeometry& AllottedGeometry);
+
 	void UpdateCanvasControlMode(const FInputEvent& InputEvent);
 
 	void OnPostImGuiUpdate();
@@ -137,8 +144,7 @@ private:
 	FSlateRenderTransform ImGuiTransform;
 	FSlateRenderTransform ImGuiRenderTransform;
 
-	mutable TArray<FSlateVertex> VertexBuffer;
-	mutable TArray<SlateIndex> IndexBuffer;
+	mutable FImGuiDrawListPainter Painter;
 
 	int32 ContextIndex = 0;
 
@@ -147,6 +153,9 @@ private:
 
 	float DPIScale = 1.f;
 
+	// Position at which we last checked the monitor DPI.
+	FVector2D MonitorDPIPosition = FVector2D::ZeroVector;
+
 	bool bInputEnabled = false;
 	bool bForegroundWindow = false;
 	bool bHideMouseCursor = true;
@@ -154,6 +163,8 @@ private:
 	bool bAdaptiveCanvasSize = false;
 	bool bUpdateCanvasSize = false;
 	bool bCanvasControlEnabled = false;
+	bool bScaleWithMonitorDPI = false;
+	bool bUpdateMonitorDPIScale = false;
 
 	TSharedPtr<SImGuiCanvasControl> CanvasControlWidget;
 	TWeakPtr<SWidget> PreviousUserFocusedWidget;
@@ -57,6 +57,20 @@ public:
 	 * @returns Simple multicast delegate to debug events called once per frame for every world to debug
 	 */
 	static FSimpleMulticastDelegate& OnMultiContextDebug();
+
+	/**
+	 * Wrap a delegate, so it is listed under the given name in the ImGui delegates profiler (ImGui.Profiler.Show).
+	 * Profiled delegates have their cost measured individually in every context and, if a frame budget is set
+	 * (ImGui.Profiler.FrameBudget), they can be skipped in frames in which they would exceed it. Skipped delegates are
+	 * marked as stale and the last output of their windows is reused.
+	 *
+	 * Returned delegate is not bound to any object, so it should be removed using the handle returned after adding it.
+	 *
+	 * @param Name - Name identifying the delegate in the profiler
+	 * @param Delegate - Delegate to profile
+	 * @returns Delegate that can be added to any ImGui debug event
+	 */
+	static FSimpleDelegate MakeProfiled(const FName& Name, FSimpleDelegate Delegate);
 };
 
 
@@ -9,6 +9,9 @@
 #include <Modules/ModuleManager.h>
 
 
+class UTextureRenderTarget2D;
+class UWorld;
+
 class FImGuiModule : public IModuleInterface
 {
 public:
@@ -118,6 +121,44 @@ public:
 	 */
 	virtual void ReleaseTexture(const FImGuiTextureHandle& Handle);
 
+	/**
+	 * Start rendering ImGui context of the given world to a render target, which can be used on in-world surfaces or
+	 * secondary displays. The whole context display area is scaled to fit in the render target. Render target is only
+	 * updated at the given rate and only when the context output changed since the last update. If render target with
+	 * that name already exists, it is updated with the new settings.
+	 *
+	 * @param Name - Name identifying the render target
+	 * @param World - World whose context should be rendered
+	 * @param Resolution - Resolution of the render target
+	 * @param UpdateRate - Maximal number of updates per second or zero to update in every frame
+	 * @returns Render target to which context is rendered or null, if the module is not started
+	 */
+	virtual UTextureRenderTarget2D* CreateRenderTarget(const FName& Name, const UWorld* World, const FIntPoint& Resolution, float UpdateRate = 15.f);
+
+	/**
+	 * Change resolution of a render target created with CreateRenderTarget. Content is rendered again in the next frame.
+	 *
+	 * @param Name - Name of the render target
+	 * @param Resolution - New resolution
+	 */
+	virtual void SetRenderTargetResolution(const FName& Name, const FIntPoint& Resolution);
+
+	/**
+	 * Change update rate of a render target created with CreateRenderTarget.
+	 *
+	 * @param Name - Name of the render target
+	 * @param UpdateRate - Maximal number of updates per second or zero to update in every frame
+	 */
+	virtual void SetRenderTargetUpdateRate(const FName& Name, float UpdateRate);
+
+	/**
+	 * Stop rendering to a render target created with CreateRenderTarget and release the reference to it. If there is
+	 * no render target with that name, this function fails silently.
+	 *
+	 * @param Name - Name of the render target
+	 */
+	virtual void ReleaseRenderTarget(const FName& Name);
+
 	virtual void RebuildFontAtlas();
 
 	/**
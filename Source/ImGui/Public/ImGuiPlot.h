@@ -0,0 +1,249 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/ArrayView.h>
+#include <Containers/CircularQueue.h>
+#include <Templates/EnableIf.h>
+#include <Traits/IsContiguousContainer.h>
+
+#include <implot.h>
+
+
+/**
+ * ImPlot helpers reading data directly from Unreal containers (TArray, TArrayView or any other contiguous container),
+ * without copying it. Values can be read from arrays of numbers or from members of arrays of structures.
+ *
+ * Like other ImPlot functions, these should be called between ImPlot::BeginPlot and ImPlot::EndPlot.
+ */
+class FImGuiPlot
+{
+public:
+
+	/**
+	 * Plot a line with values at consecutive x positions.
+	 * @param Label - Label of the plotted item
+	 * @param Values - Container with numeric values
+	 * @param Flags - ImPlot line and item flags
+	 */
+	template<typename ContainerType, typename TEnableIf<TIsContiguousContainer<ContainerType>::Value, int>::Type = 0>
+	static void PlotLine(const char* Label, const ContainerType& Values, ImPlotLineFlags Flags = 0)
+	{
+		const auto View = MakeArrayView(Values);
+		ImPlot::PlotLine(Label, View.GetData(), View.Num(), 1.0, 0.0, Flags);
+	}
+
+	/**
+	 * Plot a line with points from two containers. Extra elements of the longer one are ignored.
+	 * @param Label - Label of the plotted item
+	 * @param Xs - Container with x coordinates
+	 * @param Ys - Container with y coordinates
+	 * @param Flags - ImPlot line and item flags
+	 */
+	template<typename ContainerType, typename TEnableIf<TIsContiguousContainer<ContainerType>::Value, int>::Type = 0>
+	static void PlotLine(const char* Label, const ContainerType& Xs, const ContainerType& Ys, ImPlotLineFlags Flags = 0)
+	{
+		const auto XsView = MakeArrayView(Xs);
+		const auto YsView = MakeArrayView(Ys);
+		ImPlot::PlotLine(Label, XsView.GetData(), YsView.GetData(), FMath::Min(XsView.Num(), YsView.Num()), Flags);
+	}
+
+	/**
+	 * Plot a line with points read from members of structures.
+	 * @param Label - Label of the plotted item
+	 * @param Samples - Container with structures
+	 * @param X - Member with x coordinate
+	 * @param Y - Member with y coordinate
+	 * @param Flags - ImPlot line and item flags
+	 */
+	template<typename ContainerType, typename StructType, typename T,
+		typename TEnableIf<TIsContiguousContainer<ContainerType>::Value, int>::Type = 0>
+	static void PlotLine(const char* Label, const ContainerType& Samples, T StructType::* X, T StructType::* Y, ImPlotLineFlags Flags = 0)
+	{
+		const TArrayView<const StructType> View = MakeArrayView(Samples);
+		ImPlot::PlotLine(Label, GetMember(View, X), GetMember(View, Y), View.Num(), Flags, 0, sizeof(StructType));
+	}
+
+	/**
+	 * Plot points with values at consecutive x positions.
+	 * @param Label - Label of the plotted item
+	 * @param Values - Container with numeric values
+	 * @param Flags - ImPlot scatter and item flags
+	 */
+	template<typename ContainerType, typename TEnableIf<TIsContiguousContainer<ContainerType>::Value, int>::Type = 0>
+	static void PlotScatter(const char* Label, const ContainerType& Values, ImPlotScatterFlags Flags = 0)
+	{
+		const auto View = MakeArrayView(Values);
+		ImPlot::PlotScatter(Label, View.GetData(), View.Num(), 1.0, 0.0, Flags);
+	}
+
+	/**
+	 * Plot points from two containers. Extra elements of the longer one are ignored.
+	 * @param Label - Label of the plotted item
+	 * @param Xs - Container with x coordinates
+	 * @param Ys - Container with y coordinates
+	 * @param Flags - ImPlot scatter and item flags
+	 */
+	template<typename ContainerType, typename TEnableIf<TIsContiguousContainer<ContainerType>::Value, int>::Type = 0>
+	static void PlotScatter(const char* Label, const ContainerType& Xs, const ContainerType& Ys, ImPlotScatterFlags Flags = 0)
+	{
+		const auto XsView = MakeArrayView(Xs);
+		const auto YsView = MakeArrayView(Ys);
+		ImPlot::PlotScatter(Label, XsView.GetData(), YsView.GetData(), FMath::Min(XsView.Num(), YsView.Num()), Flags);
+	}
+
+	/**
+	 * Plot points read from members of structures.
+	 * @param Label - Label of the plotted item
+	 * @param Samples - Container with structures
+	 * @param X - Member with x coordinate
+	 * @param Y - Member with y coordinate
+	 * @param Flags - ImPlot scatter and item flags
+	 */
+	template<typename ContainerType, typename StructType, typename T,
+		typename TEnableIf<TIsContiguousContainer<ContainerType>::Value, int>::Type = 0>
+	static void PlotScatter(const char* Label, const ContainerType& Samples, T StructType::* X, T StructType::* Y, ImPlotScatterFlags Flags = 0)
+	{
+		const TArrayView<const StructType> View = MakeArrayView(Samples);
+		ImPlot::PlotScatter(Label, GetMember(View, X), GetMember(View, Y), View.Num(), Flags, 0, sizeof(StructType));
+	}
+
+private:
+
+	// Empty items are still plotted (e.g. to keep their legend entries), in which case data is never read.
+	template<typename StructType, typename T>
+	static const T* GetMember(TArrayView<const StructType> View, T StructType::* Member)
+	{
+		return View.Num() > 0 ? &(View[0].*Member) : nullptr;
+	}
+};
+
+/**
+ * Stream of plotted points, to which a producer on another thread can push points without locking. At frame time
+ * pushed points are moved to the history of a fixed capacity, from which they are plotted without copying. Once the
+ * history is full, new points overwrite the oldest ones.
+ *
+ * Until the history is full, streams are plotted with ImPlotItemFlags_CacheFit, so auto-fitting them only reads points
+ * added since the previous frame. Once points are overwritten, cached extents could only grow, so full history is fitted.
+ *
+ * Only one thread can push points and only one thread (normally the game thread) can update and plot the stream.
+ */
+template<typename T>
+class TImGuiPlotStream
+{
+public:
+
+	/**
+	 * @param InHistoryCapacity - Maximal number of plotted points
+	 * @param QueueCapacity - Number of points that can be pushed between updates (rounded up to a power of two minus one)
+	 */
+	explicit TImGuiPlotStream(int32 InHistoryCapacity, uint32 QueueCapacity = 4096)
+		: Queue(QueueCapacity + 1)
+		, HistoryCapacity(InHistoryCapacity)
+	{
+		checkf(HistoryCapacity > 0, TEXT("Plot stream history capacity must be positive, got %d."), HistoryCapacity);
+		Xs.SetNumUninitialized(HistoryCapacity);
+		Ys.SetNumUninitialized(HistoryCapacity);
+	}
+
+	/**
+	 * Push a point to the stream. Can be called from the producer thread.
+	 * @param X - X coordinate
+	 * @param Y - Y coordinate
+	 * @returns True, if point was pushed or false, if queue is full and point was dropped
+	 */
+	bool Push(T X, T Y)
+	{
+		return Queue.Enqueue(FPoint{ X, Y });
+	}
+
+	/**
+	 * Move pushed points to the history. Should be called once per frame, before plotting.
+	 * @returns Number of points moved to the history
+	 */
+	int32 Update()
+	{
+		AppendedNum = 0;
+
+		FPoint Point;
+		while (Queue.Dequeue(Point))
+		{
+			int32 Index;
+			if (HistoryNum < HistoryCapacity)
+			{
+				Index = HistoryNum++;
+			}
+			else
+			{
+				Index = HistoryHead;
+				HistoryHead = (HistoryHead + 1) % HistoryCapacity;
+			}
+
+			Xs[Index] = Point.X;
+			Ys[Index] = Point.Y;
+			AppendedNum++;
+		}
+
+		return AppendedNum;
+	}
+
+	/**
+	 * Plot the history as a line.
+	 * @param Label - Label of the plotted item
+	 * @param Flags - ImPlot line and item flags
+	 */
+	void PlotLine(const char* Label, ImPlotLineFlags Flags = 0) const
+	{
+		ImPlot::PlotLineRing(Label, Xs.GetData(), Ys.GetData(), HistoryNum, HistoryCapacity, HistoryHead,
+			PrepareItemFlags(Flags));
+	}
+
+	/**
+	 * Plot the history as points.
+	 * @param Label - Label of the plotted item
+	 * @param Flags - ImPlot scatter and item flags
+	 */
+	void PlotScatter(const char* Label, ImPlotScatterFlags Flags = 0) const
+	{
+		ImPlot::PlotScatterRing(Label, Xs.GetData(), Ys.GetData(), HistoryNum, HistoryCapacity, HistoryHead,
+			PrepareItemFlags(Flags));
+	}
+
+	// Get the number of points in the history.
+	int32 Num() const { return HistoryNum; }
+
+private:
+
+	struct FPoint
+	{
+		T X;
+		T Y;
+	};
+
+	// Get item flags for plotting the history. If fit extents can be cached, points appended in the last update are
+	// reported to ImPlot.
+	int32 PrepareItemFlags(int32 Flags) const
+	{
+		// Cached extents are only extended, so they can't be used once the oldest points are overwritten.
+		if (HistoryNum == HistoryCapacity)
+		{
+			return Flags & ~ImPlotItemFlags_CacheFit;
+		}
+
+		ImPlot::SetNextItemAppended(AppendedNum);
+		return Flags | ImPlotItemFlags_CacheFit;
+	}
+
+	TCircularQueue<FPoint> Queue;
+
+	// History ring, with the oldest point at HistoryHead.
+	TArray<T> Xs;
+	TArray<T> Ys;
+	int32 HistoryCapacity = 0;
+	int32 HistoryHead = 0;
+	int32 HistoryNum = 0;
+
+	// Points moved to the history in the last update.
+	int32 AppendedNum = 0;
+};
@@ -0,0 +1,223 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+
+#include <imgui.h>
+
+
+/**
+ * UTF-8 text stored in a rope: a balanced tree (treap) of text chunks, where every node keeps the number of bytes and
+ * line breaks in its subtree. Insertions, removals and conversions between lines and byte offsets take logarithmic
+ * time in the number of chunks, so documents of many megabytes can be edited without copying or rescanning the whole
+ * text. All offsets and lengths are in bytes.
+ */
+class IMGUI_API FImGuiTextDocument
+{
+public:
+
+	/** Creates an empty document. */
+	FImGuiTextDocument();
+
+	/**
+	 * Replace the whole text of the document.
+	 * @param Text - New text in UTF-8
+	 * @param Length - Length of the text in bytes or -1, if the text is null-terminated
+	 */
+	void SetText(const char* Text, int32 Length = -1);
+
+	/**
+	 * Get the whole text of the document.
+	 * @param OutText - Array that receives null-terminated text
+	 */
+	void GetText(TArray<ANSICHAR>& OutText) const;
+
+	/**
+	 * Get a part of the text.
+	 * @param Offset - Offset of the first byte
+	 * @param Length - Number of bytes to copy
+	 * @param OutText - Array that receives the text (not null-terminated)
+	 */
+	void GetRange(int32 Offset, int32 Length, TArray<ANSICHAR>& OutText) const;
+
+	/** Get the byte at the given offset. */
+	ANSICHAR GetChar(int32 Offset) const;
+
+	/** Get the length of the text in bytes. */
+	int32 Len() const { return GetSubtreeBytes(Root); }
+
+	/** Get the number of lines (always at least one). */
+	int32 NumLines() const { return GetSubtreeLineBreaks(Root) + 1; }
+
+	/** Get the offset of the first byte of the given line. */
+	int32 GetLineStart(int32 Line) const;
+
+	/** Get the offset of the line break that ends the given line (or the length of the text for the last line). */
+	int32 GetLineEnd(int32 Line) const;
+
+	/** Get the index of the line that contains the given offset. */
+	int32 GetLineIndex(int32 Offset) const;
+
+	/**
+	 * Insert text.
+	 * @param Offset - Offset at which text should be inserted
+	 * @param Text - Inserted text in UTF-8
+	 * @param Length - Length of the inserted text in bytes
+	 */
+	void Insert(int32 Offset, const char* Text, int32 Length);
+
+	/**
+	 * Remove text.
+	 * @param Offset - Offset of the first removed byte
+	 * @param Length - Number of removed bytes
+	 */
+	void Remove(int32 Offset, int32 Length);
+
+	/** Get the version of the document, which is incremented with every modification. */
+	uint32 GetVersion() const { return Version; }
+
+private:
+
+	struct FNode
+	{
+		TArray<ANSICHAR> Text;
+		int32 Left = INDEX_NONE;
+		int32 Right = INDEX_NONE;
+		uint32 Priority = 0;
+		int32 LineBreaks = 0;
+		int32 SubtreeBytes = 0;
+		int32 SubtreeLineBreaks = 0;
+	};
+
+	int32 GetSubtreeBytes(int32 Node) const { return Node != INDEX_NONE ? Nodes[Node].SubtreeBytes : 0; }
+	int32 GetSubtreeLineBreaks(int32 Node) const { return Node != INDEX_NONE ? Nodes[Node].SubtreeLineBreaks : 0; }
+
+	int32 AllocateNode(const char* Text, int32 Length);
+	void FreeSubtree(int32 Node);
+	void UpdateNode(int32 Node);
+
+	int32 Merge(int32 Left, int32 Right);
+	void Split(int32 Node, int32 Offset, int32& OutLeft, int32& OutRight);
+	int32 BuildChunks(const char* Text, int32 Length);
+
+	bool InsertIntoChunk(int32 Node, int32 Offset, const char* Text, int32 Length);
+	bool RemoveFromChunk(int32 Node, int32 Offset, int32 Length);
+	void CopyRange(int32 Node, int32 Begin, int32 End, TArray<ANSICHAR>& OutText) const;
+
+	// Find the offset of the line break with the given index.
+	int32 FindLineBreak(int32 Index) const;
+
+	// Nodes are stored in one array and referenced by indices. Indices of released nodes are kept for reuse.
+	TArray<FNode> Nodes;
+	TArray<int32> FreeNodes;
+	int32 Root = INDEX_NONE;
+
+	uint32 RandomState = 0x9E3779B9u;
+	uint32 Version = 0;
+};
+
+/**
+ * Multiline text editor for large documents. Unlike multiline ImGui::InputText, which converts the whole buffer and
+ * lays out all lines every frame, this editor reads and draws only visible lines of a FImGuiTextDocument and applies
+ * edits directly to the document.
+ *
+ * Supports keyboard navigation, mouse selection, clipboard and undo. The horizontal scroll range grows with the widest
+ * line drawn so far, because measuring all lines would require scanning the whole document.
+ */
+class IMGUI_API FImGuiTextEditor
+{
+public:
+
+	/** Get the edited document. Modifying it directly clears the undo history. */
+	FImGuiTextDocument& GetDocument() { return Document; }
+
+	/** Get the edited document. */
+	const FImGuiTextDocument& GetDocument() const { return Document; }
+
+	/**
+	 * Replace the text of the document and reset the editor state.
+	 * @param Text - New text in UTF-8
+	 * @param Length - Length of the text in bytes or -1, if the text is null-terminated
+	 */
+	void SetText(const char* Text, int32 Length = -1);
+
+	/** Set whether the text can be edited. Read-only text can be still selected and copied. */
+	void SetReadOnly(bool bInReadOnly) { bReadOnly = bInReadOnly; }
+
+	/** Check whether the text is read-only. */
+	bool IsReadOnly() const { return bReadOnly; }
+
+	/** Get the offset of the cursor. */
+	int32 GetCursor() const { return Cursor; }
+
+	/**
+	 * Move the cursor and clear the selection.
+	 * @param Offset - New offset of the cursor
+	 */
+	void SetCursor(int32 Offset);
+
+	/** Check whether there is a non-empty selection. */
+	bool HasSelection() const { return Cursor != SelectionAnchor; }
+
+	/** Get the offset of the first selected byte. */
+	int32 GetSelectionStart() const { return FMath::Min(Cursor, SelectionAnchor); }
+
+	/** Get the offset after the last selected byte. */
+	int32 GetSelectionEnd() const { return FMath::Max(Cursor, SelectionAnchor); }
+
+	/**
+	 * Draw the editor in the current window and process its input.
+	 * @param Label - Label used as the widget id (not displayed)
+	 * @param Size - Size of the editor, with the same meaning as in ImGui::InputTextMultiline
+	 * @returns True, if the text was edited during this call.
+	 */
+	bool Draw(const char* Label, const ImVec2& Size = ImVec2(0.f, 0.f));
+
+private:
+
+	struct FEdit
+	{
+		int32 Offset = 0;
+		TArray<ANSICHAR> Removed;
+		TArray<ANSICHAR> Inserted;
+		bool bTyping = false;
+	};
+
+	void Replace(int32 Start, int32 End, const char* Text, int32 Length, bool bTyping = false);
+	void ApplyUndo(bool bRedo);
+	void MoveCursor(int32 Offset, bool bSelect);
+
+	int32 GetPreviousChar(int32 Offset) const;
+	int32 GetNextChar(int32 Offset) const;
+	int32 GetPreviousWord(int32 Offset) const;
+	int32 GetNextWord(int32 Offset) const;
+
+	float GetLineX(int32 Line, int32 Offset) const;
+	int32 GetLineOffsetAtX(int32 Line, float X) const;
+
+	FImGuiTextDocument Document;
+
+	// Document version after the last edit made by this editor.
+	uint32 DocumentVersion = 0;
+
+	int32 Cursor = 0;
+	int32 SelectionAnchor = 0;
+
+	// Horizontal position kept when moving the cursor between lines (negative, if not set).
+	float PreferredX = -1.f;
+
+	// Width of the widest line drawn so far.
+	float MaxLineWidth = 0.f;
+
+	double CursorBlinkStart = 0.0;
+	bool bScrollToCursor = false;
+	bool bMouseSelecting = false;
+	bool bReadOnly = false;
+
+	TArray<FEdit> UndoStack;
+	int32 UndoIndex = 0;
+
+	// Scratch buffer for line text.
+	mutable TArray<ANSICHAR> LineBuffer;
+};
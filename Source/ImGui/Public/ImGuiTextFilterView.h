@@ -0,0 +1,121 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Templates/Function.h>
+#include <Templates/UniquePtr.h>
+
+#include <imgui.h>
+
+
+/**
+ * Cached list of items that pass an ImGuiTextFilter. Instead of calling ImGuiTextFilter::PassFilter for every item in
+ * every frame, the view keeps indices of items that passed the filter and only rebuilds them when the filter text or
+ * the source changes. Large sources are filtered on a background task and queries that narrow the previous one (like
+ * typing more characters) only refine the previous result instead of rescanning the whole source. Until a new result
+ * is ready, the view keeps the last one.
+ *
+ * Intended to be used with ImGuiListClipper:
+ *
+ *	FilterView.Update(Filter, Names.Num(), NamesVersion);
+ *	ImGuiListClipper Clipper;
+ *	Clipper.Begin(FilterView.Num());
+ *	while (Clipper.Step())
+ *	{
+ *		for (int32 Row = Clipper.DisplayStart; Row < Clipper.DisplayEnd; Row++)
+ *		{
+ *			ImGui::TextUnformatted(Names[FilterView[Row]]);
+ *		}
+ *	}
+ *
+ * The view should be used from a single thread. Item names are read on a background thread, so before modifying the
+ * source call Cancel() and after that pass a new source version to Update.
+ */
+class IMGUI_API FImGuiTextFilterView
+{
+public:
+
+	/** Function returning the name of the item at the given index. Called on a background thread. */
+	using FGetItemName = TFunction<const char*(int32 Index)>;
+
+	/**
+	 * Create an empty filter view.
+	 * @param InGetItemName - Function returning item names (must be safe to call from a background thread)
+	 */
+	explicit FImGuiTextFilterView(FGetItemName InGetItemName);
+
+	/** Cancels pending builds and waits for them to finish. */
+	~FImGuiTextFilterView();
+
+	// Background tasks keep references to the view, so it cannot be copied.
+	FImGuiTextFilterView(const FImGuiTextFilterView&) = delete;
+	FImGuiTextFilterView& operator=(const FImGuiTextFilterView&) = delete;
+
+	/**
+	 * Update the view. Should be called once per frame before reading indices. Collects the result of a finished build
+	 * and starts a new one if the filter text, the number of items or the source version changed since the last call.
+	 * Small sources and empty filters are handled immediately.
+	 *
+	 * @param Filter - Filter used to select items
+	 * @param ItemCount - Number of items in the source
+	 * @param SourceVersion - Version of the source data (should be changed every time the source is modified)
+	 * @returns True, if indices changed during this call.
+	 */
+	bool Update(const ImGuiTextFilter& Filter, int32 ItemCount, uint32 SourceVersion);
+
+	/**
+	 * Cancel the pending build and block until background tasks stop reading the source. Indices from the last
+	 * finished build are kept and the next Update restarts the build if needed.
+	 */
+	void Cancel();
+
+	/** Block until the pending build finishes and take its result. */
+	void Wait();
+
+	/** Whether there is a build in progress, in which case indices may come from an older query. */
+	bool IsBuilding() const { return PendingBuild.IsValid(); }
+
+	/** Get indices of items that passed the filter, in ascending order. */
+	const TArray<int32>& GetIndices() const { return Indices; }
+
+	/** Get the number of items that passed the filter. */
+	int32 Num() const { return Indices.Num(); }
+
+	/** Get the source index of the item at the given filtered row. */
+	int32 operator[](int32 Row) const { return Indices[Row]; }
+
+private:
+
+	struct FQuery
+	{
+		TArray<ANSICHAR> Text;
+		int32 ItemCount = 0;
+		uint32 SourceVersion = 0;
+		bool bValid = false;
+
+		bool Equals(const char* InText, int32 InItemCount, uint32 InSourceVersion) const;
+		void Set(const char* InText, int32 InItemCount, uint32 InSourceVersion);
+	};
+
+	struct FBuild;
+
+	void StartBuild(const ImGuiTextFilter& Filter, int32 ItemCount, uint32 SourceVersion);
+	void CommitBuild(FBuild& Build);
+	void RetirePendingBuild();
+	void ReleaseRetiredBuilds(bool bWait);
+
+	FGetItemName GetItemName;
+
+	// Result of the last finished build and the query that produced it.
+	TArray<int32> Indices;
+	FQuery IndicesQuery;
+
+	// The last query passed to Update.
+	FQuery RequestedQuery;
+
+	TUniquePtr<FBuild> PendingBuild;
+
+	// Cancelled builds, kept until their tasks finish (filters are released on the owning thread).
+	TArray<TUniquePtr<FBuild>> RetiredBuilds;
+};
@@ -0,0 +1,74 @@
+// Distributed under the MIT License (MIT) (see accompanying LICENSE file)
+
+#pragma once
+
+#include <CoreMinimal.h>
+#include <Containers/ArrayView.h>
+
+
+class UWorld;
+
+/**
+ * Batched world-space debug overlay. Primitives submitted during a frame are collected per world context, projected
+ * in batches with the view of the game viewport that displays that context, culled against the view frustum and drawn
+ * to the ImGui background draw list at the end of the frame. Labels are depth-sorted, so nearer labels are drawn on
+ * top of the farther ones.
+ *
+ * This is meant to replace per-actor ImGui::Begin/ImGui::Text calls for things like actor names, nav paths or
+ * perception cones. All functions should be called from the game thread.
+ */
+class IMGUI_API FImGuiWorldOverlay
+{
+public:
+
+	/**
+	 * Add points to the overlay of the current world (GWorld).
+	 * @param Points - World-space locations of the points
+	 * @param Color - Color of the points
+	 * @param Size - Size of the points in ImGui pixels
+	 */
+	static void AddPoints(TArrayView<const FVector> Points, const FColor& Color, float Size = 4.f);
+
+	/**
+	 * Add points to the overlay of the given world.
+	 * @param World - World for which primitives are submitted
+	 * @param Points - World-space locations of the points
+	 * @param Color - Color of the points
+	 * @param Size - Size of the points in ImGui pixels
+	 */
+	static void AddPoints(UWorld* World, TArrayView<const FVector> Points, const FColor& Color, float Size = 4.f);
+
+	/**
+	 * Add lines to the overlay of the current world (GWorld).
+	 * @param LinePoints - World-space start and end points of the lines, stored in pairs
+	 * @param Color - Color of the lines
+	 * @param Thickness - Thickness of the lines in ImGui pixels
+	 */
+	static void AddLines(TArrayView<const FVector> LinePoints, const FColor& Color, float Thickness = 1.f);
+
+	/**
+	 * Add lines to the overlay of the given world.
+	 * @param World - World for which primitives are submitted
+	 * @param LinePoints - World-space start and end points of the lines, stored in pairs
+	 * @param Color - Color of the lines
+	 * @param Thickness - Thickness of the lines in ImGui pixels
+	 */
+	static void AddLines(UWorld* World, TArrayView<const FVector> LinePoints, const FColor& Color, float Thickness = 1.f);
+
+	/**
+	 * Add labels to the overlay of the current world (GWorld).
+	 * @param Locations - World-space locations of the label centres
+	 * @param Labels - Label texts (must have the same number of elements as Locations)
+	 * @param Color - Color of the label texts
+	 */
+	static void AddLabels(TArrayView<const FVector> Locations, TArrayView<const FString> Labels, const FColor& Color);
+
+	/**
+	 * Add labels to the overlay of the given world.
+	 * @param World - World for which primitives are submitted
+	 * @param Locations - World-space locations of the label centres
+	 * @param Labels - Label texts (must have the same number of elements as Locations)
+	 * @param Color - Color of the label texts
+	 */
+	static void AddLabels(UWorld* World, TArrayView<const FVector> Locations, TArrayView<const FString> Labels, const FColor& Color);
+};
@@ -48,6 +48,7 @@
 //#define IMGUI_DISABLE_DEFAULT_FILE_FUNCTIONS              // Don't implement ImFileOpen/ImFileClose/ImFileRead/ImFileWrite and ImFileHandle so you can implement them yourself if you don't want to link with fopen/fclose/fread/fwrite. This will also disable the LogToTTY() function.
 //#define IMGUI_DISABLE_DEFAULT_ALLOCATORS                  // Don't implement default allocators calling malloc()/free() to avoid linking with them. You will need to call ImGui::SetAllocatorFunctions().
 //#define IMGUI_DISABLE_SSE                                 // Disable use of SSE intrinsics even if available
+//#define IMGUI_DISABLE_NEON                                // Disable use of NEON intrinsics (AArch64) even if available
 
 //---- Include imgui_user.h at the end of imgui.h as a convenience
 // May be convenient for some users to only explicitly include vanilla imgui.h and have extra stuff included.
@@ -102,6 +103,15 @@
 //---- ...Or use Dear ImGui's own very basic math operators.
 #define IMGUI_DEFINE_MATH_OPERATORS
 
+//---- Index ImGuiStorage with a hash table instead of keeping it sorted, so inserting keys is O(1) instead of O(N).
+// Helps with very large storages (e.g. open states of tens of thousands of tree nodes). Pairs are then kept in insertion order.
+//#define IMGUI_USE_HASHED_STORAGE
+
+//---- Hash IDs with CRC32C instead of CRC32, so they can be computed with SSE4.2 instructions (ARMv8 has instructions for both).
+// Without it, IDs are computed with CRC32 as in vanilla Dear ImGui. This changes all IDs, so settings saved in .ini files with CRC32 IDs are not found anymore.
+// On x86 this requires CPU with SSE4.2 (compile with -msse4.2 for GCC/Clang). Define IMGUI_DISABLE_CRC32_INSTRUCTIONS to use lookup tables only.
+//#define IMGUI_ENABLE_CRC32C_HASH
+
 //---- Use 32-bit vertex indices (default is 16-bit) is one way to allow large meshes with more than 64K vertices.
 // Your renderer backend will need to support it (most example renderer backends support both 16/32-bit indices).
 // Another way to allow large meshes while keeping 16-bit indices is to handle ImDrawCmd::VtxOffset in your renderer.
@@ -150,6 +150,7 @@ struct ImFontBuilderIO;             // Opaque interface to a font builder (stb_t
 struct ImFontConfig;                // Configuration data when adding a font or merging fonts
 struct ImFontGlyph;                 // A single font glyph (code point + coordinates within in ImFontAtlas + offset)
 struct ImFontGlyphRangesBuilder;    // Helper to build glyph ranges from text/string data
+struct ImFontTextCache;             // Opaque cache of measured and rendered text for a single font (see ImFontConfig::CacheText)
 struct ImColor;                     // Helper functions to create a color that can be converted to either u32 or float4 (*OBSOLETE* please avoid using)
 struct ImGuiContext;                // Dear ImGui context (opaque structure, unless including imgui_internal.h)
 struct ImGuiIO;                     // Main configuration and I/O between your application and ImGui
@@ -255,6 +256,8 @@ typedef int     (*ImGuiInputTextCallback)(ImGuiInputTextCallbackData* data);
 typedef void    (*ImGuiSizeCallback)(ImGuiSizeCallbackData* data);              // Callback function for ImGui::SetNextWindowSizeConstraints()
 typedef void*   (*ImGuiMemAllocFunc)(size_t sz, void* user_data);               // Function signature for ImGui::SetAllocatorFunctions()
 typedef void    (*ImGuiMemFreeFunc)(void* ptr, void* user_data);                // Function signature for ImGui::SetAllocatorFunctions()
+typedef int     (*ImGuiTableSortCompareFn)(int lhs, int rhs, const ImGuiTableColumnSortSpecs* spec, void* user_data); // Function signature for ImGui::TableGetSortedIndices()
+typedef void    (*ImGuiParallelForFn)(int count, void (*func)(int index, void* func_data), void* func_data, void* user_data); // Function signature for io.ParallelForFn
 
 // ImVec2: 2D vector used to store positions, sizes etc. [Compile-time configurable type]
 // This is a frequently used type in the API. Consider using IM_VEC2_CLASS_EXTRA to create implicit cast from/to our preferred type.
@@ -384,6 +387,7 @@ namespace ImGui
     IMGUI_API void          SetNextWindowFocus();                                                       // set next window to be focused / top-most. call before Begin()
     IMGUI_API void          SetNextWindowScroll(const ImVec2& scroll);                                  // set next window scrolling value (use < 0.0f to not affect a given axis).
     IMGUI_API void          SetNextWindowBgAlpha(float alpha);                                          // set next window background color alpha. helper to easily override the Alpha component of ImGuiCol_WindowBg/ChildBg/PopupBg. you may also use ImGuiWindowFlags_NoBackground.
+    IMGUI_API void          SetNextWindowRetainKey(ImGuiID key);                                        // set next window key for ImGuiWindowFlags_Retained: contents are submitted again when it changes (e.g. pass a hash or version of displayed data).
     IMGUI_API void          SetWindowPos(const ImVec2& pos, ImGuiCond cond = 0);                        // (not recommended) set current window position - call within Begin()/End(). prefer using SetNextWindowPos(), as this may incur tearing and side-effects.
     IMGUI_API void          SetWindowSize(const ImVec2& size, ImGuiCond cond = 0);                      // (not recommended) set current window size - call within Begin()/End(). set to ImVec2(0, 0) to force an auto-fit. prefer using SetNextWindowSize(), as this may incur tearing and minor side-effects.
     IMGUI_API void          SetWindowCollapsed(bool collapsed, ImGuiCond cond = 0);                     // (not recommended) set current window collapsed state. prefer using SetNextWindowCollapsed().
@@ -792,8 +796,14 @@ namespace ImGui
     //   When 'sort_specs->SpecsDirty == true' you should sort your data. It will be true when sorting specs have
     //   changed since last call, or the first time. Make sure to set 'SpecsDirty = false' after sorting,
     //   else you may wastefully sort your data every frame!
+    // - Sorting: alternatively call TableGetSortedIndices() to let the table sort and keep a permutation of item indices.
+    //   'compare_func' compares items 'lhs' and 'rhs' in ascending order of the column in 'spec' (returning <0, 0 or >0).
+    //   Items are compared by each spec in order, then by index, so sorting is stable. The permutation is only sorted again
+    //   when specs, items_count or 'data_version' change: bump 'data_version' whenever your data changes.
+    //   Large permutations are sorted in parallel when io.ParallelForFn is set, so 'compare_func' needs to be thread-safe.
     // - Functions args 'int column_n' treat the default value of -1 as the same as passing the current column index.
     IMGUI_API ImGuiTableSortSpecs*  TableGetSortSpecs();                        // get latest sort specs for the table (NULL if not sorting).  Lifetime: don't hold on this pointer over multiple frames or past any subsequent call to BeginTable().
+    IMGUI_API const int*            TableGetSortedIndices(int items_count, ImGuiTableSortCompareFn compare_func, void* user_data, ImU32 data_version); // get indices of 'items_count' items in display order (NULL if table is not sortable). Lifetime: don't hold on this pointer past any subsequent call to BeginTable().
     IMGUI_API int                   TableGetColumnCount();                      // return number of columns (value passed to BeginTable)
     IMGUI_API int                   TableGetColumnIndex();                      // return current column index.
     IMGUI_API int                   TableGetRowIndex();                         // return current row index.
@@ -1009,6 +1019,7 @@ enum ImGuiWindowFlags_
     ImGuiWindowFlags_NoNavInputs            = 1 << 16,  // No gamepad/keyboard navigation within the window
     ImGuiWindowFlags_NoNavFocus             = 1 << 17,  // No focusing toward this window with gamepad/keyboard navigation (e.g. skipped by CTRL+TAB)
     ImGuiWindowFlags_UnsavedDocument        = 1 << 18,  // Display a dot next to the title. When used in a tab/docking context, tab is selected when clicking the X + closure is not assumed (will wait for user to stop submitting the tab). Otherwise closure is assumed when pressing the X, so if you keep submitting the tab may reappear at end of tab bar.
+    ImGuiWindowFlags_Retained               = 1 << 20,  // Reuse contents drawn on last frame while window is not hovered, focused or interacted with, and its position, size, scroll and key set with SetNextWindowRetainKey() are unchanged. Begin() returns false when contents are reused. Top-level windows without child windows only. Style, pushed colors/variables and font at the time of Begin() are part of the key, but style changes made while submitting contents and anything else contents depend on (e.g. displayed data) need to be passed to SetNextWindowRetainKey().
     ImGuiWindowFlags_NoNav                  = ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
     ImGuiWindowFlags_NoDecoration           = ImGuiWindowFlags_NoTitleBar | ImGuiWindowFlags_NoResize | ImGuiWindowFlags_NoScrollbar | ImGuiWindowFlags_NoCollapse,
     ImGuiWindowFlags_NoInputs               = ImGuiWindowFlags_NoMouseInputs | ImGuiWindowFlags_NoNavInputs | ImGuiWindowFlags_NoNavFocus,
@@ -2138,6 +2149,11 @@ struct ImGuiIO
     // (default to use native imm32 api on Windows)
     void        (*SetPlatformImeDataFn)(ImGuiViewport* viewport, ImGuiPlatformImeData* data);
 
+    // Optional: Run func(index, func_data) for each index in [0, count), possibly on multiple threads, and return once all calls are done.
+    // (used to sort large tables in TableGetSortedIndices(), default to NULL which runs everything on the calling thread)
+    ImGuiParallelForFn ParallelForFn;
+    void*       ParallelForUserData;
+
     // Optional: Platform locale
     ImWchar     PlatformLocaleDecimalPoint;     // '.'              // [Experimental] Configure decimal point e.g. '.' or ',' useful for some languages (e.g. German), generally pulled from *localeconv()->decimal_point
 
@@ -2390,6 +2406,7 @@ struct ImGuiTextBuffer
 // Typically you don't have to worry about this since a storage is held within each Window.
 // We use it to e.g. store collapse state for a tree (Int 0/1)
 // This is optimized for efficient lookup (dichotomy into a contiguous buffer) and rare insertion (typically tied to user interactions aka max once a frame)
+// With IMGUI_USE_HASHED_STORAGE, pairs are kept in insertion order and indexed by an open addressing hash table instead, so insertion is O(1) too.
 // You can use it as custom user storage for temporary values. Declare your own storage if, for example:
 // - You want to manipulate the open/close state of a particular sub-tree in your interface (tree node uses Int 0/1 to store their state).
 // - You want to store custom debug data easily without adding or editing structures in your code (probably not efficient, but convenient)
@@ -2407,11 +2424,24 @@ struct ImGuiStorage
     };
 
     ImVector<ImGuiStoragePair>      Data;
+#ifdef IMGUI_USE_HASHED_STORAGE
+    // [Internal] Hash table of indices+1 of pairs in Data (0 for empty slots). If Data was resized directly (e.g. before BuildSortByKey),
+    // it is rebuilt by the next Set***()/Get***Ref() call or BuildSortByKey(). Const Get***() functions never modify the storage and
+    // use a linear scan while the index is stale. Don't modify keys in Data directly without resizing it, as that isn't detected.
+    ImVector<int>                   Index;
+    int                             IndexedCount;
+
+    ImGuiStorage()      { IndexedCount = 0; }
+#endif
 
-    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N)
+    // - Get***() functions find pair, never add/allocate. Pairs are sorted so a query is O(log N) (O(1) with IMGUI_USE_HASHED_STORAGE, where pairs are in insertion order)
     // - Set***() functions find pair, insertion on demand if missing.
     // - Sorted insertion is costly, paid once. A typical frame shouldn't need to insert any new pair.
+#ifdef IMGUI_USE_HASHED_STORAGE
+    void                Clear() { Data.clear(); Index.clear(); IndexedCount = 0; }
+#else
     void                Clear() { Data.clear(); }
+#endif
     IMGUI_API int       GetInt(ImGuiID key, int default_val = 0) const;
     IMGUI_API void      SetInt(ImGuiID key, int val);
     IMGUI_API bool      GetBool(ImGuiID key, bool default_val = false) const;
@@ -2871,6 +2901,7 @@ struct ImFontConfig
     float           RasterizerMultiply;     // 1.0f     // Linearly brighten (>1.0f) or darken (<1.0f) font output. Brightening small fonts may be a good workaround to make them more readable. This is a silly thing we may remove in the future.
     float           RasterizerDensity;      // 1.0f     // DPI scale for rasterization, not altering other font metrics: make it easy to swap between e.g. a 100% and a 400% fonts for a zooming display. IMPORTANT: If you increase this it is expected that you increase font scale accordingly, otherwise quality may look lowered.
     ImWchar         EllipsisChar;           // -1       // Explicitly specify unicode codepoint of ellipsis character. When fonts are being merged first specified ellipsis will be used.
+    bool            CacheText;              // false    // Cache size and glyph quads of text measured or rendered in consecutive frames, so static text (e.g. labels in large tables) skips per-glyph work. Ignored in merged fonts (set it in the first one).
 
     // [Internal]
     char            Name[40];               // Name (strictly to ease debugging)
@@ -3075,6 +3106,7 @@ struct ImFont
     float                       Scale;              // 4     // in  // = 1.f      // Base font scale, multiplied by the per-window font scale which you can adjust with SetWindowFontScale()
     float                       Ascent, Descent;    // 4+4   // out //            // Ascent: distance from top to bottom of e.g. 'A' [0..FontSize]
     int                         MetricsTotalSurface;// 4     // out //            // Total surface in pixels to get an idea of the font rasterization/texture cost (not exact, we approximate the cost of padding between glyphs)
+    ImFontTextCache*            TextCache;          // 4-8   // out //            // Cache of measured and rendered text, if enabled with ImFontConfig::CacheText
     ImU8                        Used4kPagesMap[(IM_UNICODE_CODEPOINT_MAX+1)/4096/8]; // 2 bytes if ImWchar=ImWchar16, 34 bytes if ImWchar==ImWchar32. Store 1-bit for each block of 4K codepoints that has one active glyph. This is mainly used to facilitate iterations across all used codepoints.
 
     // Methods
@@ -3101,6 +3133,7 @@ struct ImFont
     IMGUI_API void              AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst = true); // Makes 'dst' character/glyph points to 'src' character/glyph. Currently needs to be called AFTER fonts have been built.
     IMGUI_API void              SetGlyphVisible(ImWchar c, bool visible);
     IMGUI_API bool              IsGlyphRangeUnused(unsigned int c_begin, unsigned int c_last);
+    IMGUI_API void              ClearTextCache();
 };
 
 //-----------------------------------------------------------------------------
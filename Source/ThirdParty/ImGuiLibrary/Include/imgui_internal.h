@@ -61,6 +61,24 @@ Index of this file:
 #include <immintrin.h>
 #endif
 
+// Enable NEON intrinsics if available (AArch64 only, which also has vector division and square root)
+#if (defined __aarch64__ || defined _M_ARM64) && !defined(IMGUI_DISABLE_NEON)
+#define IMGUI_ENABLE_NEON
+#include <arm_neon.h>
+#endif
+
+// Enable CRC32 instructions for hashing IDs if available (see IMGUI_ENABLE_CRC32C_HASH in imconfig.h)
+// - SSE4.2 only implements CRC32C, so it is used only when IMGUI_ENABLE_CRC32C_HASH is defined.
+// - ARMv8 implements both CRC32 and CRC32C.
+#if defined(IMGUI_ENABLE_CRC32C_HASH) && defined(IMGUI_ENABLE_SSE) && (defined __SSE4_2__ || defined __AVX__ || (defined _MSC_VER && !defined __clang__)) && !defined(IMGUI_DISABLE_CRC32_INSTRUCTIONS)
+#define IMGUI_ENABLE_SSE4_2_CRC
+#include <nmmintrin.h>
+#endif
+#if defined(__ARM_FEATURE_CRC32) && !defined(IMGUI_DISABLE_CRC32_INSTRUCTIONS)
+#define IMGUI_ENABLE_ARM_CRC
+#include <arm_acle.h>
+#endif
+
 // Visual Studio warnings
 #ifdef _MSC_VER
 #pragma warning (push)
@@ -731,6 +749,35 @@ struct ImGuiTextIndex
     void            append(const char* base, int old_size, int new_size);
 };
 
+// Helper: ImGuiFrameArena
+// Bump allocator for transient data that only needs to live until the end of the frame. Reset by NewFrame().
+// Memory is carved from blocks that are kept between frames. When a frame needs more than one block, they are replaced by a single block
+// that fits all of them on the next reset, so once the high-water mark is reached, allocations don't reach the heap anymore.
+// Objects are neither constructed nor destructed: only use it for plain data.
+#ifndef IMGUI_FRAME_ARENA_MIN_BLOCK_SIZE
+#define IMGUI_FRAME_ARENA_MIN_BLOCK_SIZE    (64 * 1024)
+#endif
+struct IMGUI_API ImGuiFrameArena
+{
+    ImVector<void*>     Blocks;
+    ImVector<size_t>    BlockSizes;
+    size_t              BlockOffset;            // Offset of free memory in the last block
+    size_t              FrameUsedBytes;         // Bytes allocated since the last reset
+    size_t              PeakUsedBytes;          // Highest number of bytes allocated in one frame
+    int                 FrameAllocCount;        // Number of Alloc() calls since the last reset
+    int                 FrameHeapAllocCount;    // Number of blocks allocated from the heap since the last reset
+    int                 HeapAllocCount;         // Number of blocks allocated from the heap since creation
+
+    ImGuiFrameArena()   { BlockOffset = FrameUsedBytes = PeakUsedBytes = 0; FrameAllocCount = FrameHeapAllocCount = HeapAllocCount = 0; }
+    ~ImGuiFrameArena()  { Clear(); }
+    void*               Alloc(size_t size, size_t alignment = 16);      // Alignment must be a power of two, no higher than 16.
+    template<typename T>
+    T*                  AllocArray(int count)   { IM_STATIC_ASSERT(alignof(T) <= 16); return (T*)Alloc(sizeof(T) * (size_t)count, alignof(T)); }
+    size_t              GetCapacity() const     { size_t sz = 0; for (size_t block_size : BlockSizes) sz += block_size; return sz; }
+    void                Reset();                // Release everything allocated since the last reset, keeping the memory.
+    void                Clear();                // Release everything and free the memory.
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] ImDrawList support
 //-----------------------------------------------------------------------------
@@ -1123,6 +1170,7 @@ enum ImGuiNextWindowDataFlags_
     ImGuiNextWindowDataFlags_HasBgAlpha         = 1 << 6,
     ImGuiNextWindowDataFlags_HasScroll          = 1 << 7,
     ImGuiNextWindowDataFlags_HasChildFlags      = 1 << 8,
+    ImGuiNextWindowDataFlags_HasRetainKey       = 1 << 9,
 };
 
 // Storage for SetNexWindow** functions
@@ -1143,6 +1191,7 @@ struct ImGuiNextWindowData
     ImGuiSizeCallback           SizeCallback;
     void*                       SizeCallbackUserData;
     float                       BgAlphaVal;             // Override background alpha
+    ImGuiID                     RetainKeyVal;           // User key for ImGuiWindowFlags_Retained
     ImVec2                      MenuBarOffsetMinVal;    // (Always on) This is not exposed publicly, so we don't clear it and it doesn't have a corresponding flag (could we? for consistency?)
 
     ImGuiNextWindowData()       { memset(this, 0, sizeof(*this)); }
@@ -2231,6 +2280,9 @@ struct ImGuiContext
     ImGuiIDStackTool        DebugIDStackTool;
     ImGuiDebugAllocInfo     DebugAllocInfo;
 
+    // Transient memory
+    ImGuiFrameArena         FrameArena;                         // Scratch memory reset at the beginning of every frame
+
     // Misc
     float                   FramerateSecPerFrame[60];           // Calculate estimate of framerate for user over the last 60 frames..
     int                     FramerateSecPerFrameIdx;
@@ -2596,6 +2648,8 @@ struct IMGUI_API ImGuiWindow
     int                     MemoryDrawListIdxCapacity;          // Backup of last idx/vtx count, so when waking up the window we can preallocate and avoid iterative alloc/copy
     int                     MemoryDrawListVtxCapacity;
     bool                    MemoryCompacted;                    // Set when window extraneous data have been garbage collected
+    bool                    RetainedContents;                   // Set when contents drawn on last frame are reused (ImGuiWindowFlags_Retained). Items are skipped.
+    ImGuiID                 RetainedKey;                        // Hash of state in which contents were drawn, or 0 when they can't be reused on next frame.
 
 public:
     ImGuiWindow(ImGuiContext* context, const char* name);
@@ -2858,6 +2912,11 @@ struct IMGUI_API ImGuiTable
     ImVector<ImGuiTableColumnSortSpecs> SortSpecsMulti;     // FIXME-OPT: Using a small-vector pattern would be good.
     ImGuiTableSortSpecs         SortSpecs;                  // Public facing sorts specs, this is what we return in TableGetSortSpecs()
     ImGuiTableColumnIdx         SortSpecsCount;
+    ImU32                       SortSpecsVersion;           // Incremented every time sort specs are rebuilt
+    ImVector<int>               SortedIndices;              // Permutation returned by TableGetSortedIndices()
+    ImU32                       SortedIndicesSpecsVersion;  // SortSpecsVersion, data version and compare function SortedIndices were sorted with
+    ImU32                       SortedIndicesDataVersion;
+    ImGuiTableSortCompareFn     SortedIndicesCompareFunc;
     ImGuiTableColumnIdx         ColumnsEnabledCount;        // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         ColumnsEnabledFixedCount;   // Number of enabled columns (<= ColumnsCount)
     ImGuiTableColumnIdx         DeclColumnsCount;           // Count calls to TableSetupColumn()
@@ -3470,6 +3529,7 @@ namespace ImGui
     IMGUI_API void          DebugLog(const char* fmt, ...) IM_FMTARGS(1);
     IMGUI_API void          DebugLogV(const char* fmt, va_list args) IM_FMTLIST(1);
     IMGUI_API void          DebugAllocHook(ImGuiDebugAllocInfo* info, int frame_count, void* ptr, size_t size); // size >= 0 : alloc, size = -1 : free
+    IMGUI_API bool          DebugAllocHookSetThreadEnabled(bool enabled);  // Disable to not record allocations of the calling thread in the current context. Returns previous state.
 
     // Debug Tools
     IMGUI_API void          ErrorCheckEndFrameRecover(ImGuiErrorLogCallback log_callback, void* user_data = NULL);
@@ -3548,6 +3608,57 @@ IMGUI_API void      ImFontAtlasBuildRender32bppRectFromString(ImFontAtlas* atlas
 IMGUI_API void      ImFontAtlasBuildMultiplyCalcLookupTable(unsigned char out_table[256], float in_multiply_factor);
 IMGUI_API void      ImFontAtlasBuildMultiplyRectAlpha8(const unsigned char table[256], unsigned char* pixels, int x, int y, int w, int h, int stride);
 
+// Cache of text measured and rendered with a font (see ImFontConfig::CacheText)
+// - Texts are cached by content and parameters, so it also works for labels formatted every frame into temporary buffers.
+// - Texts are only cached once they are seen in two different frames, which keeps constantly changing texts out of the cache.
+// - Rendered text is cached as a run of visible glyphs with their positions, which skips UTF-8 decoding, glyph lookups and word wrapping.
+//   We don't cache whole vertices: writing them costs the same either way, and 4 cached vertices per glyph are much colder in memory than glyphs.
+// - Runs are only reused if the whole text is inside the clip rectangle. Otherwise the text is rendered directly, with clipping.
+// - Frames are counted with NewFrame() calls of all contexts using the font. Like the rest of the atlas, the cache isn't thread-safe.
+#define IMGUI_FONT_TEXT_CACHE_MIN_LENGTH        32      // Shorter texts are processed directly unless wrapped (for short ASCII text, lookups cost more than they save)
+#define IMGUI_FONT_TEXT_CACHE_SEEN_FRAMES       8       // Texts are cached if they are seen again within [8..16) frames
+#define IMGUI_FONT_TEXT_CACHE_RELEASE_FRAMES    120     // Entries unused for that many frames are released
+
+struct ImFontTextRunGlyph
+{
+    float           X;                      // Pen position relative to the truncated text position
+    int             Line;
+    int             GlyphIndex;             // Index in ImFont::Glyphs (merged fonts can exceed 16-bit range)
+};
+
+struct ImFontTextCacheEntry
+{
+    ImVector<char>  Text;                   // Copy of the text, to detect hash collisions
+    float           Size;
+    float           MaxWidth;
+    float           WrapWidth;
+    int             LastFrame;
+    bool            Built;                  // Set once the text was measured or rendered into this entry
+    ImVec2          TextSize;               // CalcTextSizeA() result
+    int             RemainingOffset;        // CalcTextSizeA() 'remaining' output, relative to text start
+    ImVector<ImFontTextRunGlyph> Run;       // RenderText() visible glyphs
+    ImVec2          RunMin, RunMax;         // RenderText() bounding box of visible glyphs, relative to the truncated text position
+};
+
+enum ImFontTextCacheKind
+{
+    ImFontTextCacheKind_Size,
+    ImFontTextCacheKind_Run,
+};
+
+struct ImFontTextCache
+{
+    ImPool<ImFontTextCacheEntry> Entries;
+    ImGuiStorage    SeenFrames[2];          // Key -> frame + 1 of texts seen but not cached yet. Entries move to the other storage every IMGUI_FONT_TEXT_CACHE_SEEN_FRAMES frames.
+    int             SeenCurrent;
+    int             Frame;
+
+    ImFontTextCache()   { SeenCurrent = Frame = 0; }
+    IMGUI_API void  NewFrame();
+    IMGUI_API void  Clear();
+    IMGUI_API ImFontTextCacheEntry* GetEntry(ImFontTextCacheKind kind, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end);
+};
+
 //-----------------------------------------------------------------------------
 // [SECTION] Test Engine specific hooks (imgui_test_engine)
 //-----------------------------------------------------------------------------
@@ -704,6 +704,125 @@ void ImDrawList::PrimQuadUV(const ImVec2& a, const ImVec2& b, const ImVec2& c, c
 #define IM_FIXNORMAL2F_MAX_INVLEN2          100.0f // 500.0f (see #4053, #3366)
 #define IM_FIXNORMAL2F(VX,VY)               { float d2 = VX*VX + VY*VY; if (d2 > 0.000001f) { float inv_len2 = 1.0f / d2; if (inv_len2 > IM_FIXNORMAL2F_MAX_INVLEN2) inv_len2 = IM_FIXNORMAL2F_MAX_INVLEN2; VX *= inv_len2; VY *= inv_len2; } } (void)0
 
+// Compute normals of segments [points[i], points[i + 1]] for i in [0, count), with points[points_count] wrapping to points[0].
+// Same as IM_NORMALIZE2F_OVER_ZERO() on each segment, but processes 4 segments at a time with SSE or NEON.
+static void ImDrawListComputeSegmentNormals(const ImVec2* points, const int points_count, const int count, ImVec2* out_normals)
+{
+    int i = 0;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 sign = _mm_set1_ps(-0.0f);
+    for (; i + 4 < points_count && i + 4 <= count; i += 4)
+    {
+        const float* p = &points[i].x;
+        const __m128 p0 = _mm_loadu_ps(p), p1 = _mm_loadu_ps(p + 4);        // Points i..i+3
+        const __m128 q0 = _mm_loadu_ps(p + 2), q1 = _mm_loadu_ps(p + 6);    // Points i+1..i+4
+        __m128 dx = _mm_sub_ps(_mm_shuffle_ps(q0, q1, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0)));
+        __m128 dy = _mm_sub_ps(_mm_shuffle_ps(q0, q1, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1)));
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy));
+        const __m128 mask = _mm_cmpgt_ps(d2, zero);
+        const __m128 inv_len = _mm_or_ps(_mm_and_ps(mask, _mm_rsqrt_ps(d2)), _mm_andnot_ps(mask, one));
+        dx = _mm_mul_ps(dx, inv_len);
+        dy = _mm_mul_ps(dy, inv_len);
+        const __m128 nx = dy;
+        const __m128 ny = _mm_xor_ps(dx, sign);
+        _mm_storeu_ps(&out_normals[i].x, _mm_unpacklo_ps(nx, ny));
+        _mm_storeu_ps(&out_normals[i + 2].x, _mm_unpackhi_ps(nx, ny));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    for (; i + 4 < points_count && i + 4 <= count; i += 4)
+    {
+        const float32x4x2_t p = vld2q_f32(&points[i].x);
+        const float32x4x2_t q = vld2q_f32(&points[i + 1].x);
+        float32x4_t dx = vsubq_f32(q.val[0], p.val[0]);
+        float32x4_t dy = vsubq_f32(q.val[1], p.val[1]);
+        const float32x4_t d2 = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy));
+        const float32x4_t inv_len = vbslq_f32(vcgtq_f32(d2, zero), vdivq_f32(one, vsqrtq_f32(d2)), one);
+        dx = vmulq_f32(dx, inv_len);
+        dy = vmulq_f32(dy, inv_len);
+        float32x4x2_t n;
+        n.val[0] = dy;
+        n.val[1] = vnegq_f32(dx);
+        vst2q_f32(&out_normals[i].x, n);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        const int i2 = (i + 1) == points_count ? 0 : i + 1;
+        float dx = points[i2].x - points[i].x;
+        float dy = points[i2].y - points[i].y;
+        IM_NORMALIZE2F_OVER_ZERO(dx, dy);
+        out_normals[i].x = dy;
+        out_normals[i].y = -dx;
+    }
+}
+
+// Compute normals at each point, averaged from normals of the segments ending and starting there (normals[-1] wrapping to normals[count - 1]).
+// Same as IM_FIXNORMAL2F() on each point, but processes 4 points at a time with SSE or NEON.
+static void ImDrawListComputePointNormals(const ImVec2* normals, const int count, ImVec2* out_normals)
+{
+    IM_ASSERT(count > 0);
+    {
+        float dm_x = (normals[count - 1].x + normals[0].x) * 0.5f;
+        float dm_y = (normals[count - 1].y + normals[0].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_normals[0].x = dm_x;
+        out_normals[0].y = dm_y;
+    }
+    int i = 1;
+#if defined(IMGUI_ENABLE_SSE)
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 min_len2 = _mm_set1_ps(0.000001f);
+    const __m128 max_invlen2 = _mm_set1_ps(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i + 4 <= count; i += 4)
+    {
+        const float* n = &normals[i].x;
+        const __m128 p0 = _mm_loadu_ps(n - 2), p1 = _mm_loadu_ps(n + 2);    // Normals i-1..i+2
+        const __m128 q0 = _mm_loadu_ps(n), q1 = _mm_loadu_ps(n + 4);        // Normals i..i+3
+        __m128 dm_x = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(q0, q1, _MM_SHUFFLE(2, 0, 2, 0))), half);
+        __m128 dm_y = _mm_mul_ps(_mm_add_ps(_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(q0, q1, _MM_SHUFFLE(3, 1, 3, 1))), half);
+        const __m128 d2 = _mm_add_ps(_mm_mul_ps(dm_x, dm_x), _mm_mul_ps(dm_y, dm_y));
+        const __m128 mask = _mm_cmpgt_ps(d2, min_len2);
+        const __m128 inv_len2 = _mm_min_ps(_mm_div_ps(one, d2), max_invlen2);
+        const __m128 scale = _mm_or_ps(_mm_and_ps(mask, inv_len2), _mm_andnot_ps(mask, one));
+        dm_x = _mm_mul_ps(dm_x, scale);
+        dm_y = _mm_mul_ps(dm_y, scale);
+        _mm_storeu_ps(&out_normals[i].x, _mm_unpacklo_ps(dm_x, dm_y));
+        _mm_storeu_ps(&out_normals[i + 2].x, _mm_unpackhi_ps(dm_x, dm_y));
+    }
+#elif defined(IMGUI_ENABLE_NEON)
+    const float32x4_t half = vdupq_n_f32(0.5f);
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t min_len2 = vdupq_n_f32(0.000001f);
+    const float32x4_t max_invlen2 = vdupq_n_f32(IM_FIXNORMAL2F_MAX_INVLEN2);
+    for (; i + 4 <= count; i += 4)
+    {
+        const float32x4x2_t p = vld2q_f32(&normals[i - 1].x);
+        const float32x4x2_t q = vld2q_f32(&normals[i].x);
+        float32x4x2_t dm;
+        dm.val[0] = vmulq_f32(vaddq_f32(p.val[0], q.val[0]), half);
+        dm.val[1] = vmulq_f32(vaddq_f32(p.val[1], q.val[1]), half);
+        const float32x4_t d2 = vaddq_f32(vmulq_f32(dm.val[0], dm.val[0]), vmulq_f32(dm.val[1], dm.val[1]));
+        const float32x4_t scale = vbslq_f32(vcgtq_f32(d2, min_len2), vminq_f32(vdivq_f32(one, d2), max_invlen2), one);
+        dm.val[0] = vmulq_f32(dm.val[0], scale);
+        dm.val[1] = vmulq_f32(dm.val[1], scale);
+        vst2q_f32(&out_normals[i].x, dm);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        float dm_x = (normals[i - 1].x + normals[i].x) * 0.5f;
+        float dm_y = (normals[i - 1].y + normals[i].y) * 0.5f;
+        IM_FIXNORMAL2F(dm_x, dm_y);
+        out_normals[i].x = dm_x;
+        out_normals[i].y = dm_y;
+    }
+}
+
 // TODO: Thickness anti-aliased lines cap are missing their AA fringe.
 // We avoid using the ImVec2 math operators here to reduce cost to a minimum for debug/non-inlined builds.
 void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32 col, ImDrawFlags flags, float thickness)
@@ -740,24 +859,22 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
         PrimReserve(idx_count, vtx_count);
 
         // Temporary buffer
-        // The first <points_count> items are normals at each line point, then after that there are either 2 or 4 temp points for each line point
-        _Data->TempBuffer.reserve_discard(points_count * ((use_texture || !thick_line) ? 3 : 5));
+        // The first <points_count> items are normals of each line segment, then normals at each line point
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        ImVec2* temp_points = temp_normals + points_count;
+        ImVec2* temp_point_normals = temp_normals + points_count;
 
         // Calculate normals (tangents) for each line segment
-        for (int i1 = 0; i1 < count; i1++)
-        {
-            const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1;
-            float dx = points[i2].x - points[i1].x;
-            float dy = points[i2].y - points[i1].y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i1].x = dy;
-            temp_normals[i1].y = -dx;
-        }
+        ImDrawListComputeSegmentNormals(points, points_count, count, temp_normals);
         if (!closed)
             temp_normals[points_count - 1] = temp_normals[points_count - 2];
 
+        // Average normals at each point
+        // If line is not closed, the first point needs to be generated differently as there are no normals to blend
+        ImDrawListComputePointNormals(temp_normals, points_count, temp_point_normals);
+        if (!closed)
+            temp_point_normals[0] = temp_normals[0];
+
         // If we are drawing a one-pixel-wide line without a texture, or a textured line of any width, we only need 2 or 3 vertices per point
         if (use_texture || !thick_line)
         {
@@ -771,38 +888,13 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             //   allow scaling geometry while preserving one-screen-pixel AA fringe).
             const float half_draw_size = use_texture ? ((thickness * 0.5f) + 1) : AA_SIZE;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                temp_points[0] = points[0] + temp_normals[0] * half_draw_size;
-                temp_points[1] = points[0] - temp_normals[0] * half_draw_size;
-                temp_points[(points_count-1)*2+0] = points[points_count-1] + temp_normals[points_count-1] * half_draw_size;
-                temp_points[(points_count-1)*2+1] = points[points_count-1] - temp_normals[points_count-1] * half_draw_size;
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being connected to the final one (as n+1 wraps)
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : i1 + 1; // i2 is the second point of the line segment
                 const unsigned int idx2 = ((i1 + 1) == points_count) ? _VtxCurrentIdx : (idx1 + (use_texture ? 2 : 3)); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                dm_x *= half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
-                dm_y *= half_draw_size;
-
-                // Add temporary vertexes for the outer edges
-                ImVec2* out_vtx = &temp_points[i2 * 2];
-                out_vtx[0].x = points[i2].x + dm_x;
-                out_vtx[0].y = points[i2].y + dm_y;
-                out_vtx[1].x = points[i2].x - dm_x;
-                out_vtx[1].y = points[i2].y - dm_y;
-
                 if (use_texture)
                 {
                     // Add indices for two triangles
@@ -840,8 +932,10 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 ImVec2 tex_uv1(tex_uvs.z, tex_uvs.w);
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = temp_points[i * 2 + 0]; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 1]; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
+                    const float dm_x = temp_point_normals[i].x * half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
+                    const float dm_y = temp_point_normals[i].y * half_draw_size;
+                    _VtxWritePtr[0].pos.x = points[i].x + dm_x; _VtxWritePtr[0].pos.y = points[i].y + dm_y; _VtxWritePtr[0].uv = tex_uv0; _VtxWritePtr[0].col = col; // Left-side outer edge
+                    _VtxWritePtr[1].pos.x = points[i].x - dm_x; _VtxWritePtr[1].pos.y = points[i].y - dm_y; _VtxWritePtr[1].uv = tex_uv1; _VtxWritePtr[1].col = col; // Right-side outer edge
                     _VtxWritePtr += 2;
                 }
             }
@@ -850,9 +944,11 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
                 // If we're not using a texture, we need the center vertex as well
                 for (int i = 0; i < points_count; i++)
                 {
-                    _VtxWritePtr[0].pos = points[i];              _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
-                    _VtxWritePtr[1].pos = temp_points[i * 2 + 0]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
-                    _VtxWritePtr[2].pos = temp_points[i * 2 + 1]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
+                    const float dm_x = temp_point_normals[i].x * half_draw_size; // dm_x, dm_y are offset to the outer edge of the AA area
+                    const float dm_y = temp_point_normals[i].y * half_draw_size;
+                    _VtxWritePtr[0].pos = points[i];                                                    _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col;       // Center of line
+                    _VtxWritePtr[1].pos.x = points[i].x + dm_x; _VtxWritePtr[1].pos.y = points[i].y + dm_y; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col_trans; // Left-side outer edge
+                    _VtxWritePtr[2].pos.x = points[i].x - dm_x; _VtxWritePtr[2].pos.y = points[i].y - dm_y; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col_trans; // Right-side outer edge
                     _VtxWritePtr += 3;
                 }
             }
@@ -862,49 +958,13 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // [PATH 2] Non texture-based lines (thick): we need to draw the solid line core and thus require four vertices per point
             const float half_inner_thickness = (thickness - AA_SIZE) * 0.5f;
 
-            // If line is not closed, the first and last points need to be generated differently as there are no normals to blend
-            if (!closed)
-            {
-                const int points_last = points_count - 1;
-                temp_points[0] = points[0] + temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[1] = points[0] + temp_normals[0] * (half_inner_thickness);
-                temp_points[2] = points[0] - temp_normals[0] * (half_inner_thickness);
-                temp_points[3] = points[0] - temp_normals[0] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 0] = points[points_last] + temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-                temp_points[points_last * 4 + 1] = points[points_last] + temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 2] = points[points_last] - temp_normals[points_last] * (half_inner_thickness);
-                temp_points[points_last * 4 + 3] = points[points_last] - temp_normals[points_last] * (half_inner_thickness + AA_SIZE);
-            }
-
-            // Generate the indices to form a number of triangles for each line segment, and the vertices for the line edges
-            // This takes points n and n+1 and writes into n+1, with the first point in a closed line being generated from the final one (as n+1 wraps)
-            // FIXME-OPT: Merge the different loops, possibly remove the temporary buffer.
+            // Generate the indices to form a number of triangles for each line segment
+            // This takes points n and n+1, with the first point in a closed line being connected to the final one (as n+1 wraps)
             unsigned int idx1 = _VtxCurrentIdx; // Vertex index for start of line segment
             for (int i1 = 0; i1 < count; i1++) // i1 is the first point of the line segment
             {
-                const int i2 = (i1 + 1) == points_count ? 0 : (i1 + 1); // i2 is the second point of the line segment
                 const unsigned int idx2 = (i1 + 1) == points_count ? _VtxCurrentIdx : (idx1 + 4); // Vertex index for end of segment
 
-                // Average normals
-                float dm_x = (temp_normals[i1].x + temp_normals[i2].x) * 0.5f;
-                float dm_y = (temp_normals[i1].y + temp_normals[i2].y) * 0.5f;
-                IM_FIXNORMAL2F(dm_x, dm_y);
-                float dm_out_x = dm_x * (half_inner_thickness + AA_SIZE);
-                float dm_out_y = dm_y * (half_inner_thickness + AA_SIZE);
-                float dm_in_x = dm_x * half_inner_thickness;
-                float dm_in_y = dm_y * half_inner_thickness;
-
-                // Add temporary vertices
-                ImVec2* out_vtx = &temp_points[i2 * 4];
-                out_vtx[0].x = points[i2].x + dm_out_x;
-                out_vtx[0].y = points[i2].y + dm_out_y;
-                out_vtx[1].x = points[i2].x + dm_in_x;
-                out_vtx[1].y = points[i2].y + dm_in_y;
-                out_vtx[2].x = points[i2].x - dm_in_x;
-                out_vtx[2].y = points[i2].y - dm_in_y;
-                out_vtx[3].x = points[i2].x - dm_out_x;
-                out_vtx[3].y = points[i2].y - dm_out_y;
-
                 // Add indexes
                 _IdxWritePtr[0]  = (ImDrawIdx)(idx2 + 1); _IdxWritePtr[1]  = (ImDrawIdx)(idx1 + 1); _IdxWritePtr[2]  = (ImDrawIdx)(idx1 + 2);
                 _IdxWritePtr[3]  = (ImDrawIdx)(idx1 + 2); _IdxWritePtr[4]  = (ImDrawIdx)(idx2 + 2); _IdxWritePtr[5]  = (ImDrawIdx)(idx2 + 1);
@@ -920,10 +980,14 @@ void ImDrawList::AddPolyline(const ImVec2* points, const int points_count, ImU32
             // Add vertices
             for (int i = 0; i < points_count; i++)
             {
-                _VtxWritePtr[0].pos = temp_points[i * 4 + 0]; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
-                _VtxWritePtr[1].pos = temp_points[i * 4 + 1]; _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
-                _VtxWritePtr[2].pos = temp_points[i * 4 + 2]; _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
-                _VtxWritePtr[3].pos = temp_points[i * 4 + 3]; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
+                const float dm_out_x = temp_point_normals[i].x * (half_inner_thickness + AA_SIZE);
+                const float dm_out_y = temp_point_normals[i].y * (half_inner_thickness + AA_SIZE);
+                const float dm_in_x = temp_point_normals[i].x * half_inner_thickness;
+                const float dm_in_y = temp_point_normals[i].y * half_inner_thickness;
+                _VtxWritePtr[0].pos.x = points[i].x + dm_out_x; _VtxWritePtr[0].pos.y = points[i].y + dm_out_y; _VtxWritePtr[0].uv = opaque_uv; _VtxWritePtr[0].col = col_trans;
+                _VtxWritePtr[1].pos.x = points[i].x + dm_in_x;  _VtxWritePtr[1].pos.y = points[i].y + dm_in_y;  _VtxWritePtr[1].uv = opaque_uv; _VtxWritePtr[1].col = col;
+                _VtxWritePtr[2].pos.x = points[i].x - dm_in_x;  _VtxWritePtr[2].pos.y = points[i].y - dm_in_y;  _VtxWritePtr[2].uv = opaque_uv; _VtxWritePtr[2].col = col;
+                _VtxWritePtr[3].pos.x = points[i].x - dm_out_x; _VtxWritePtr[3].pos.y = points[i].y - dm_out_y; _VtxWritePtr[3].uv = opaque_uv; _VtxWritePtr[3].col = col_trans;
                 _VtxWritePtr += 4;
             }
         }
@@ -989,30 +1053,17 @@ void ImDrawList::AddConvexPolyFilled(const ImVec2* points, const int points_coun
             _IdxWritePtr += 3;
         }
 
-        // Compute normals
-        _Data->TempBuffer.reserve_discard(points_count);
+        // Compute normals of edges, then average them at each point
+        _Data->TempBuffer.reserve_discard(points_count * 2);
         ImVec2* temp_normals = _Data->TempBuffer.Data;
-        for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
-        {
-            const ImVec2& p0 = points[i0];
-            const ImVec2& p1 = points[i1];
-            float dx = p1.x - p0.x;
-            float dy = p1.y - p0.y;
-            IM_NORMALIZE2F_OVER_ZERO(dx, dy);
-            temp_normals[i0].x = dy;
-            temp_normals[i0].y = -dx;
-        }
+        ImVec2* temp_point_normals = temp_normals + points_count;
+        ImDrawListComputeSegmentNormals(points, points_count, points_count, temp_normals);
+        ImDrawListComputePointNormals(temp_normals, points_count, temp_point_normals);
 
         for (int i0 = points_count - 1, i1 = 0; i1 < points_count; i0 = i1++)
         {
-            // Average normals
-            const ImVec2& n0 = temp_normals[i0];
-            const ImVec2& n1 = temp_normals[i1];
-            float dm_x = (n0.x + n1.x) * 0.5f;
-            float dm_y = (n0.y + n1.y) * 0.5f;
-            IM_FIXNORMAL2F(dm_x, dm_y);
-            dm_x *= AA_SIZE * 0.5f;
-            dm_y *= AA_SIZE * 0.5f;
+            const float dm_x = temp_point_normals[i1].x * (AA_SIZE * 0.5f);
+            const float dm_y = temp_point_normals[i1].y * (AA_SIZE * 0.5f);
 
             // Add vertices
             _VtxWritePtr[0].pos.x = (points[i1].x - dm_x); _VtxWritePtr[0].pos.y = (points[i1].y - dm_y); _VtxWritePtr[0].uv = uv; _VtxWritePtr[0].col = col;        // Inner
@@ -2705,8 +2756,8 @@ static bool ImFontAtlasBuildWithStbTruetype(ImFontAtlas* atlas)
 
 const ImFontBuilderIO* ImFontAtlasGetBuilderForStbTruetype()
 {
-    static ImFontBuilderIO io;
-    io.FontBuilder_Build = ImFontAtlasBuildWithStbTruetype;
+    // Initialized once (not assigned on every call), so atlases can be built concurrently.
+    static const ImFontBuilderIO io = { ImFontAtlasBuildWithStbTruetype };
     return &io;
 }
 
@@ -3262,6 +3313,7 @@ ImFont::ImFont()
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
     memset(Used4kPagesMap, 0, sizeof(Used4kPagesMap));
+    TextCache = NULL;
 }
 
 ImFont::~ImFont()
@@ -3281,6 +3333,9 @@ void    ImFont::ClearOutputData()
     DirtyLookupTables = true;
     Ascent = Descent = 0.0f;
     MetricsTotalSurface = 0;
+    if (TextCache)
+        IM_DELETE(TextCache);
+    TextCache = NULL;
 }
 
 static ImWchar FindFirstExistingGlyph(ImFont* font, const ImWchar* candidate_chars, int candidate_chars_count)
@@ -3373,6 +3428,17 @@ void ImFont::BuildLookupTable()
         EllipsisCharStep = (glyph->X1 - glyph->X0) + 1.0f;
         EllipsisWidth = EllipsisCharStep * 3.0f - 1.0f;
     }
+
+    // Setup text cache. Glyphs may have changed, so previously cached text is discarded.
+    const bool cache_text = ConfigData && ConfigData->CacheText;
+    if (cache_text && TextCache == NULL)
+        TextCache = IM_NEW(ImFontTextCache)();
+    if (!cache_text && TextCache != NULL)
+    {
+        IM_DELETE(TextCache);
+        TextCache = NULL;
+    }
+    ClearTextCache();
 }
 
 // API is designed this way to avoid exposing the 4K page size
@@ -3392,6 +3458,13 @@ void ImFont::SetGlyphVisible(ImWchar c, bool visible)
 {
     if (ImFontGlyph* glyph = (ImFontGlyph*)(void*)FindGlyph((ImWchar)c))
         glyph->Visible = visible ? 1 : 0;
+    ClearTextCache();
+}
+
+void ImFont::ClearTextCache()
+{
+    if (TextCache)
+        TextCache->Clear();
 }
 
 void ImFont::GrowIndex(int new_size)
@@ -3463,6 +3536,7 @@ void ImFont::AddRemapChar(ImWchar dst, ImWchar src, bool overwrite_dst)
     GrowIndex(dst + 1);
     IndexLookup[dst] = (src < index_size) ? IndexLookup.Data[src] : (ImWchar)-1;
     IndexAdvanceX[dst] = (src < index_size) ? IndexAdvanceX.Data[src] : 1.0f;
+    ClearTextCache();
 }
 
 const ImFontGlyph* ImFont::FindGlyph(ImWchar c) const
@@ -3596,11 +3670,100 @@ const char* ImFont::CalcWordWrapPositionA(float scale, const char* text, const c
     return s;
 }
 
+void ImFontTextCache::Clear()
+{
+    Entries.Clear();
+    SeenFrames[0].Clear();
+    SeenFrames[1].Clear();
+}
+
+void ImFontTextCache::NewFrame()
+{
+    Frame++;
+
+    // Forget texts seen in the older period (keeping memory, as the storage fills again in next frames)
+    if (Frame % IMGUI_FONT_TEXT_CACHE_SEEN_FRAMES == 0)
+    {
+        SeenCurrent ^= 1;
+        SeenFrames[SeenCurrent].Data.resize(0);
+    }
+
+    // Release entries which were not used recently
+    if (Frame % IMGUI_FONT_TEXT_CACHE_RELEASE_FRAMES == 0)
+    {
+        ImVector<ImGuiStorage::ImGuiStoragePair>& map = Entries.Map.Data;
+        for (int n = 0; n < map.Size; n++)
+            if (map[n].val_i != -1 && Entries.Buf[map[n].val_i].LastFrame < Frame - IMGUI_FONT_TEXT_CACHE_RELEASE_FRAMES)
+                Entries.Remove(map[n].key, (ImPoolIdx)map[n].val_i);
+
+        // The pool keeps keys of removed entries, which would accumulate with changing text
+        int alive_count = 0;
+        for (int n = 0; n < map.Size; n++)
+            if (map[n].val_i != -1)
+                map[alive_count++] = map[n];
+        if (alive_count != map.Size)
+        {
+            map.resize(alive_count);
+            Entries.Map.BuildSortByKey();
+        }
+    }
+}
+
+// Returns entry for given text and parameters, or NULL if the text should be processed directly.
+// New entries are returned with Built == false, for the caller to fill them.
+ImFontTextCacheEntry* ImFontTextCache::GetEntry(ImFontTextCacheKind kind, float size, float max_width, float wrap_width, const char* text_begin, const char* text_end)
+{
+    const int text_len = (int)(text_end - text_begin);
+    if (text_len < IMGUI_FONT_TEXT_CACHE_MIN_LENGTH && !(wrap_width > 0.0f && text_len > 0))
+        return NULL;
+
+    // Using ImHashData() and not ImHashStr(), which would ignore everything before "###"
+    const float params[3] = { size, max_width, wrap_width };
+    ImGuiID key = ImHashData(params, sizeof(params), (ImGuiID)kind);
+    key = ImHashData(text_begin, (size_t)text_len, key);
+
+    if (ImFontTextCacheEntry* entry = Entries.GetByKey(key))
+    {
+        // On a hash collision, leave the entry to the text that created it
+        if (entry->Size != size || entry->MaxWidth != max_width || entry->WrapWidth != wrap_width || entry->Text.Size != text_len || memcmp(entry->Text.Data, text_begin, (size_t)text_len) != 0)
+            return NULL;
+        entry->LastFrame = Frame;
+        return entry;
+    }
+
+    // Only cache texts seen in an earlier frame
+    int seen_frame = SeenFrames[SeenCurrent].GetInt(key, 0);
+    if (seen_frame == 0)
+        seen_frame = SeenFrames[SeenCurrent ^ 1].GetInt(key, 0);
+    if (seen_frame == 0)
+        SeenFrames[SeenCurrent].SetInt(key, Frame + 1);
+    if (seen_frame == 0 || seen_frame == Frame + 1)
+        return NULL;
+
+    ImFontTextCacheEntry* entry = Entries.GetOrAddByKey(key);
+    entry->Text.resize(text_len);
+    memcpy(entry->Text.Data, text_begin, (size_t)text_len);
+    entry->Size = size;
+    entry->MaxWidth = max_width;
+    entry->WrapWidth = wrap_width;
+    entry->LastFrame = Frame;
+    entry->Built = false;
+    return entry;
+}
+
 ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, const char* text_begin, const char* text_end, const char** remaining) const
 {
     if (!text_end)
         text_end = text_begin + strlen(text_begin); // FIXME-OPT: Need to avoid this.
 
+    ImFontTextCacheEntry* cache_entry = TextCache ? TextCache->GetEntry(ImFontTextCacheKind_Size, size, max_width, wrap_width, text_begin, text_end) : NULL;
+    if (cache_entry && cache_entry->Built)
+    {
+        if (remaining)
+            *remaining = text_begin + cache_entry->RemainingOffset;
+        return cache_entry->TextSize;
+    }
+
     const float line_height = size;
     const float scale = size / FontSize;
 
@@ -3671,9 +3834,94 @@ ImVec2 ImFont::CalcTextSizeA(float size, float max_width, float wrap_width, cons
     if (remaining)
         *remaining = s;
 
+    if (cache_entry)
+    {
+        cache_entry->TextSize = text_size;
+        cache_entry->RemainingOffset = (int)(s - text_begin);
+        cache_entry->Built = true;
+    }
+
     return text_size;
 }
 
+// Layout visible glyphs of a text for ImFont::RenderText(), without clipping.
+static void ImFontBuildTextCacheRun(const ImFont* font, ImFontTextCacheEntry* entry, float size, const char* text_begin, const char* text_end, float wrap_width)
+{
+    const float scale = size / font->FontSize;
+    const float line_height = font->FontSize * scale;
+    const bool word_wrap_enabled = (wrap_width > 0.0f);
+    const char* word_wrap_eol = NULL;
+
+    entry->Run.resize(0);
+    entry->RunMin = ImVec2(FLT_MAX, FLT_MAX);
+    entry->RunMax = ImVec2(-FLT_MAX, -FLT_MAX);
+    entry->Built = true;
+
+    float x = 0.0f;
+    int line = 0;
+    const char* s = text_begin;
+    while (s < text_end && line <= 0xFFFF)
+    {
+        if (word_wrap_enabled)
+        {
+            if (!word_wrap_eol)
+                word_wrap_eol = font->CalcWordWrapPositionA(scale, s, text_end, wrap_width - x);
+
+            if (s >= word_wrap_eol)
+            {
+                x = 0.0f;
+                line++;
+                word_wrap_eol = NULL;
+                s = CalcWordWrapNextLineStartA(s, text_end); // Wrapping skips upcoming blanks
+                continue;
+            }
+        }
+
+        // Decode and advance source
+        unsigned int c = (unsigned int)*s;
+        if (c < 0x80)
+            s += 1;
+        else
+            s += ImTextCharFromUtf8(&c, s, text_end);
+
+        if (c < 32)
+        {
+            if (c == '\n')
+            {
+                x = 0.0f;
+                line++;
+                continue;
+            }
+            if (c == '\r')
+                continue;
+        }
+
+        const ImFontGlyph* glyph = font->FindGlyph((ImWchar)c);
+        if (glyph == NULL)
+            continue;
+
+        if (glyph->Visible)
+        {
+            ImFontTextRunGlyph run_glyph;
+            run_glyph.X = x;
+            run_glyph.Line = line;
+            run_glyph.GlyphIndex = (int)(glyph - font->Glyphs.Data);
+            entry->Run.push_back(run_glyph);
+            const float y = line * line_height;
+            entry->RunMin = ImMin(entry->RunMin, ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale));
+            entry->RunMax = ImMax(entry->RunMax, ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale));
+        }
+        x += glyph->AdvanceX * scale;
+    }
+
+    // Too many lines to be indexed, make sure the text is always rendered directly
+    if (s < text_end)
+    {
+        entry->Run.resize(0);
+        entry->RunMax = ImVec2(FLT_MAX, FLT_MAX);
+    }
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, ImWchar c) const
 {
@@ -3689,6 +3937,50 @@ void ImFont::RenderChar(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     draw_list->PrimRectUV(ImVec2(x + glyph->X0 * scale, y + glyph->Y0 * scale), ImVec2(x + glyph->X1 * scale, y + glyph->Y1 * scale), ImVec2(glyph->U0, glyph->V0), ImVec2(glyph->U1, glyph->V1), col);
 }
 
+// Render glyph run cached by ImFontBuildTextCacheRun(), at truncated position (x, y).
+static void ImFontRenderTextCacheRun(const ImFont* font, ImDrawList* draw_list, float size, float x, float y, ImU32 col, const ImFontTextCacheEntry* entry)
+{
+    const float scale = size / font->FontSize;
+    const float line_height = font->FontSize * scale;
+    const int glyphs_count = entry->Run.Size;
+    if (glyphs_count == 0)
+        return;
+    draw_list->PrimReserve(glyphs_count * 6, glyphs_count * 4);
+    ImDrawVert*  vtx_write = draw_list->_VtxWritePtr;
+    ImDrawIdx*   idx_write = draw_list->_IdxWritePtr;
+    unsigned int vtx_index = draw_list->_VtxCurrentIdx;
+
+    const ImU32 col_untinted = col | ~IM_COL32_A_MASK;
+    for (const ImFontTextRunGlyph& run_glyph : entry->Run)
+    {
+        const ImFontGlyph* glyph = &font->Glyphs.Data[run_glyph.GlyphIndex];
+        const float glyph_x = x + run_glyph.X;
+        const float glyph_y = y + run_glyph.Line * line_height;
+        const float x1 = glyph_x + glyph->X0 * scale;
+        const float x2 = glyph_x + glyph->X1 * scale;
+        const float y1 = glyph_y + glyph->Y0 * scale;
+        const float y2 = glyph_y + glyph->Y1 * scale;
+        const float u1 = glyph->U0;
+        const float v1 = glyph->V0;
+        const float u2 = glyph->U1;
+        const float v2 = glyph->V1;
+        const ImU32 glyph_col = glyph->Colored ? col_untinted : col;
+        vtx_write[0].pos.x = x1; vtx_write[0].pos.y = y1; vtx_write[0].col = glyph_col; vtx_write[0].uv.x = u1; vtx_write[0].uv.y = v1;
+        vtx_write[1].pos.x = x2; vtx_write[1].pos.y = y1; vtx_write[1].col = glyph_col; vtx_write[1].uv.x = u2; vtx_write[1].uv.y = v1;
+        vtx_write[2].pos.x = x2; vtx_write[2].pos.y = y2; vtx_write[2].col = glyph_col; vtx_write[2].uv.x = u2; vtx_write[2].uv.y = v2;
+        vtx_write[3].pos.x = x1; vtx_write[3].pos.y = y2; vtx_write[3].col = glyph_col; vtx_write[3].uv.x = u1; vtx_write[3].uv.y = v2;
+        idx_write[0] = (ImDrawIdx)(vtx_index); idx_write[1] = (ImDrawIdx)(vtx_index + 1); idx_write[2] = (ImDrawIdx)(vtx_index + 2);
+        idx_write[3] = (ImDrawIdx)(vtx_index); idx_write[4] = (ImDrawIdx)(vtx_index + 2); idx_write[5] = (ImDrawIdx)(vtx_index + 3);
+        vtx_write += 4;
+        vtx_index += 4;
+        idx_write += 6;
+    }
+
+    draw_list->_VtxWritePtr = vtx_write;
+    draw_list->_IdxWritePtr = idx_write;
+    draw_list->_VtxCurrentIdx = vtx_index;
+}
+
 // Note: as with every ImDrawList drawing function, this expects that the font atlas texture is bound.
 void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, ImU32 col, const ImVec4& clip_rect, const char* text_begin, const char* text_end, float wrap_width, bool cpu_fine_clip) const
 {
@@ -3701,6 +3993,19 @@ void ImFont::RenderText(ImDrawList* draw_list, float size, const ImVec2& pos, Im
     if (y > clip_rect.w)
         return;
 
+    // Use glyph run cached in previous frames, if the whole text is visible
+    if (TextCache != NULL)
+        if (ImFontTextCacheEntry* cache_entry = TextCache->GetEntry(ImFontTextCacheKind_Run, size, 0.0f, wrap_width, text_begin, text_end))
+        {
+            if (!cache_entry->Built)
+                ImFontBuildTextCacheRun(this, cache_entry, size, text_begin, text_end, wrap_width);
+            if (x + cache_entry->RunMin.x >= clip_rect.x && y + cache_entry->RunMin.y >= clip_rect.y && x + cache_entry->RunMax.x <= clip_rect.z && y + cache_entry->RunMax.y <= clip_rect.w)
+            {
+                ImFontRenderTextCacheRun(this, draw_list, size, x, y, col, cache_entry);
+                return;
+            }
+        }
+
     const float start_x = x;
     const float scale = size / FontSize;
     const float line_height = FontSize * scale;
@@ -4095,9 +4400,10 @@ static unsigned int stb_decompress_length(const unsigned char *input)
     return (input[8] << 24) + (input[9] << 16) + (input[10] << 8) + input[11];
 }
 
-static unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
-static const unsigned char *stb__barrier_in_b;
-static unsigned char *stb__dout;
+// Decompression state is thread-local, so font atlases can be built concurrently (e.g. on worker threads).
+static thread_local unsigned char *stb__barrier_out_e, *stb__barrier_out_b;
+static thread_local const unsigned char *stb__barrier_in_b;
+static thread_local unsigned char *stb__dout;
 static void stb__match(const unsigned char *data, unsigned int length)
 {
     // INVERSE of memmove... write each byte before copying the next...
@@ -257,6 +257,8 @@ static const int TABLE_DRAW_CHANNEL_NOCLIP = 2;                     // When usin
 static const float TABLE_BORDER_SIZE                     = 1.0f;    // FIXME-TABLE: Currently hard-coded because of clipping assumptions with outer borders rendering.
 static const float TABLE_RESIZE_SEPARATOR_HALF_THICKNESS = 4.0f;    // Extend outside inner borders.
 static const float TABLE_RESIZE_SEPARATOR_FEEDBACK_TIMER = 0.06f;   // Delay/timer before making the hover feedback (color+cursor) visible because tables/columns tends to be more cramped.
+static const int TABLE_SORT_RUN_SIZE = 32;                          // Runs sorted with insertion sort before merging, in TableGetSortedIndices()
+static const int TABLE_SORT_PARALLEL_CHUNK_SIZE = 16384;            // Items per chunk sorted by one io.ParallelForFn call, in TableGetSortedIndices()
 
 // Helper
 inline ImGuiTableFlags TableFixFlags(ImGuiTableFlags flags, ImGuiWindow* outer_window)
@@ -2734,6 +2736,7 @@ void ImGui::TableDrawBorders(ImGuiTable* table)
 // [SECTION] Tables: Sorting
 //-------------------------------------------------------------------------
 // - TableGetSortSpecs()
+// - TableGetSortedIndices()
 // - TableFixColumnSortDirection() [Internal]
 // - TableGetColumnNextSortDirection() [Internal]
 // - TableSetColumnSortDirection() [Internal]
@@ -2763,6 +2766,152 @@ ImGuiTableSortSpecs* ImGui::TableGetSortSpecs()
     return &table->SortSpecs;
 }
 
+// Sorting state for TableGetSortedIndices(), shared by parallel sorting tasks
+struct ImGuiTableSortContext
+{
+    const ImGuiTableColumnSortSpecs*    Specs;
+    int                                 SpecsCount;
+    ImGuiTableSortCompareFn             CompareFunc;
+    void*                               UserData;
+    int*                                Indices;
+    int*                                Temp;           // Scratch buffer of the same size
+    int                                 Count;
+    int                                 RunSize;        // Size of sorted runs (chunks) merged by the current parallel pass
+};
+
+static inline bool TableSortIsLess(const ImGuiTableSortContext* ctx, int lhs, int rhs)
+{
+    for (int spec_n = 0; spec_n < ctx->SpecsCount; spec_n++)
+    {
+        const ImGuiTableColumnSortSpecs* spec = &ctx->Specs[spec_n];
+        const int delta = ctx->CompareFunc(lhs, rhs, spec, ctx->UserData);
+        if (delta != 0)
+            return (spec->SortDirection == ImGuiSortDirection_Descending) ? (delta > 0) : (delta < 0);
+    }
+    return lhs < rhs; // Keep order of equal items
+}
+
+// Merge sorted runs [begin, mid) and [mid, end) of 'src' into 'dst'
+static void TableSortMerge(const ImGuiTableSortContext* ctx, const int* src, int* dst, int begin, int mid, int end)
+{
+    if (mid >= end || !TableSortIsLess(ctx, src[mid], src[mid - 1]))
+    {
+        memcpy(dst + begin, src + begin, (size_t)(end - begin) * sizeof(int)); // Already in order
+        return;
+    }
+    int lhs_n = begin, rhs_n = mid, out_n = begin;
+    while (lhs_n < mid && rhs_n < end)
+        dst[out_n++] = TableSortIsLess(ctx, src[rhs_n], src[lhs_n]) ? src[rhs_n++] : src[lhs_n++];
+    while (lhs_n < mid)
+        dst[out_n++] = src[lhs_n++];
+    while (rhs_n < end)
+        dst[out_n++] = src[rhs_n++];
+}
+
+// Sort range [begin, end) of ctx->Indices: insertion sort of small runs, then merge passes alternating between buffers
+static void TableSortRange(const ImGuiTableSortContext* ctx, int begin, int end)
+{
+    int* data = ctx->Indices;
+    for (int run_begin = begin; run_begin < end; run_begin += TABLE_SORT_RUN_SIZE)
+    {
+        const int run_end = ImMin(run_begin + TABLE_SORT_RUN_SIZE, end);
+        for (int n = run_begin + 1; n < run_end; n++)
+        {
+            const int value = data[n];
+            int dst_n = n;
+            for (; dst_n > run_begin && TableSortIsLess(ctx, value, data[dst_n - 1]); dst_n--)
+                data[dst_n] = data[dst_n - 1];
+            data[dst_n] = value;
+        }
+    }
+
+    int* src = ctx->Indices;
+    int* dst = ctx->Temp;
+    for (int width = TABLE_SORT_RUN_SIZE; width < end - begin; width *= 2)
+    {
+        for (int run_begin = begin; run_begin < end; run_begin += width * 2)
+            TableSortMerge(ctx, src, dst, run_begin, ImMin(run_begin + width, end), ImMin(run_begin + width * 2, end));
+        ImSwap(src, dst);
+    }
+    if (src != ctx->Indices)
+        memcpy(ctx->Indices + begin, src + begin, (size_t)(end - begin) * sizeof(int));
+}
+
+static void TableSortChunkTask(int chunk_n, void* data)
+{
+    const ImGuiTableSortContext* ctx = (const ImGuiTableSortContext*)data;
+    const int begin = chunk_n * ctx->RunSize;
+    TableSortRange(ctx, begin, ImMin(begin + ctx->RunSize, ctx->Count));
+}
+
+static void TableSortMergeTask(int pair_n, void* data)
+{
+    const ImGuiTableSortContext* ctx = (const ImGuiTableSortContext*)data;
+    const int begin = pair_n * ctx->RunSize * 2;
+    TableSortMerge(ctx, ctx->Indices, ctx->Temp, begin, ImMin(begin + ctx->RunSize, ctx->Count), ImMin(begin + ctx->RunSize * 2, ctx->Count));
+}
+
+// Sort chunks in parallel with io.ParallelForFn, then merge pairs of sorted chunks in parallel passes
+static void TableSortIndices(ImGuiTableSortContext* ctx)
+{
+    ImGuiContext& g = *GImGui;
+    const int chunks_count = (ctx->Count + TABLE_SORT_PARALLEL_CHUNK_SIZE - 1) / TABLE_SORT_PARALLEL_CHUNK_SIZE;
+    if (g.IO.ParallelForFn == NULL || chunks_count < 2)
+    {
+        TableSortRange(ctx, 0, ctx->Count);
+        return;
+    }
+
+    int* indices = ctx->Indices;
+    ctx->RunSize = TABLE_SORT_PARALLEL_CHUNK_SIZE;
+    g.IO.ParallelForFn(chunks_count, TableSortChunkTask, ctx, g.IO.ParallelForUserData);
+    for (; ctx->RunSize < ctx->Count; ctx->RunSize *= 2)
+    {
+        const int pairs_count = (ctx->Count + ctx->RunSize * 2 - 1) / (ctx->RunSize * 2);
+        g.IO.ParallelForFn(pairs_count, TableSortMergeTask, ctx, g.IO.ParallelForUserData);
+        ImSwap(ctx->Indices, ctx->Temp);
+    }
+    if (ctx->Indices != indices)
+        memcpy(indices, ctx->Indices, (size_t)ctx->Count * sizeof(int));
+}
+
+// Return indices of items in the order of current sort specs, sorting them only when specs, items count or data version changed.
+// Lifetime: don't hold on this pointer past any subsequent call to BeginTable()!
+const int* ImGui::TableGetSortedIndices(int items_count, ImGuiTableSortCompareFn compare_func, void* user_data, ImU32 data_version)
+{
+    ImGuiContext& g = *GImGui;
+    ImGuiTable* table = g.CurrentTable;
+    IM_ASSERT(table != NULL);
+    IM_ASSERT(items_count >= 0 && compare_func != NULL);
+
+    const ImGuiTableSortSpecs* sort_specs = TableGetSortSpecs();
+    if (sort_specs == NULL)
+        return NULL;
+    if (table->SortedIndices.Size == items_count && table->SortedIndicesSpecsVersion == table->SortSpecsVersion && table->SortedIndicesDataVersion == data_version && table->SortedIndicesCompareFunc == compare_func)
+        return table->SortedIndices.Data;
+
+    table->SortedIndices.resize(items_count);
+    for (int n = 0; n < items_count; n++)
+        table->SortedIndices[n] = n;
+    if (sort_specs->SpecsCount > 0 && items_count > 1)
+    {
+        ImGuiTableSortContext ctx;
+        ctx.Specs = sort_specs->Specs;
+        ctx.SpecsCount = sort_specs->SpecsCount;
+        ctx.CompareFunc = compare_func;
+        ctx.UserData = user_data;
+        ctx.Indices = table->SortedIndices.Data;
+        ctx.Temp = g.FrameArena.AllocArray<int>(items_count);
+        ctx.Count = items_count;
+        ctx.RunSize = 0;
+        TableSortIndices(&ctx);
+    }
+    table->SortedIndicesSpecsVersion = table->SortSpecsVersion;
+    table->SortedIndicesDataVersion = data_version;
+    table->SortedIndicesCompareFunc = compare_func;
+    return table->SortedIndices.Data;
+}
+
 static inline ImGuiSortDirection TableGetColumnAvailSortDirection(ImGuiTableColumn* column, int n)
 {
     IM_ASSERT(n < column->SortDirectionsAvailCount);
@@ -2904,6 +3053,7 @@ void ImGui::TableSortSpecsBuild(ImGuiTable* table)
         table->SortSpecsMulti.resize(table->SortSpecsCount <= 1 ? 0 : table->SortSpecsCount);
         table->SortSpecs.SpecsDirty = true; // Mark as dirty for user
         table->IsSortSpecsDirty = false; // Mark as not dirty for us
+        table->SortSpecsVersion++;
     }
 
     // Write output
@@ -3779,6 +3929,7 @@ void ImGui::TableGcCompactTransientBuffers(ImGuiTable* table)
     IM_ASSERT(table->MemoryCompacted == false);
     table->SortSpecs.Specs = NULL;
     table->SortSpecsMulti.clear();
+    table->SortedIndices.clear();
     table->IsSortSpecsDirty = true; // FIXME: In theory shouldn't have to leak into user performing a sort on resume.
     table->ColumnsNames.clear();
     table->MemoryCompacted = true;
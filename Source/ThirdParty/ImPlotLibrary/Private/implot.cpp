@@ -457,6 +457,13 @@ void Initialize(ImPlotContext* ctx) {
     ResetCtxForNextAlignedPlots(ctx);
     ResetCtxForNextSubplot(ctx);
 
+    ctx->LineLodSweepFrame = -1;
+    ctx->HistogramSweepFrame = -1;
+    ctx->HeatmapTextureCallback = nullptr;
+    ctx->HeatmapTextureCallbackData = nullptr;
+    ctx->ParallelForCallback = nullptr;
+    ctx->ParallelForCallbackData = nullptr;
+
     const ImU32 Deep[]     = {4289753676, 4283598045, 4285048917, 4283584196, 4289950337, 4284512403, 4291005402, 4287401100, 4285839820, 4291671396                        };
     const ImU32 Dark[]     = {4280031972, 4290281015, 4283084621, 4288892568, 4278222847, 4281597951, 4280833702, 4290740727, 4288256409                                    };
     const ImU32 Pastel[]   = {4289639675, 4293119411, 4291161036, 4293184478, 4289124862, 4291624959, 4290631909, 4293712637, 4294111986                                    };
@@ -633,13 +640,12 @@ bool ShowLegendEntries(ImPlotItemGroup& items, const ImRect& legend_bb, bool hov
         return hovered;
     // build render order
     ImPlotContext& gp = *GImPlot;
-    ImVector<int>& indices = gp.TempInt1;
-    indices.resize(num_items);
+    int* indices = GImGui->FrameArena.AllocArray<int>(num_items);
     for (int i = 0; i < num_items; ++i)
         indices[i] = i;
     if (ImHasFlag(items.Legend.Flags, ImPlotLegendFlags_Sort) && num_items > 1) {
         gp.SortItems = &items;
-        qsort(indices.Data, num_items, sizeof(int), LegendSortingComp);
+        qsort(indices, num_items, sizeof(int), LegendSortingComp);
     }
     // render
     for (int i = 0; i < num_items; ++i) {
@@ -840,6 +846,91 @@ void AddTicksCustom(const double* values, const char* const labels[], int n, ImP
     }
 }
 
+ImVec2 CalcTickLabelSize(const char* label) {
+    ImPlotContext& gp = *GImPlot;
+    ImGuiContext& g = *GImGui;
+    ImGuiID key = ImHashData(&g.Font, sizeof(g.Font));
+    key = ImHashData(&g.FontSize, sizeof(g.FontSize), key);
+    key = ImHashStr(label, 0, key);
+    const int idx = gp.LabelSizeIndices.GetInt(key, 0);
+    if (idx > 0)
+        return gp.LabelSizes[idx - 1];
+    if (gp.LabelSizes.Size >= IMPLOT_LABEL_SIZE_CACHE_MAX) {
+        gp.LabelSizeIndices.Clear();
+        gp.LabelSizes.shrink(0);
+    }
+    const ImVec2 size = ImGui::CalcTextSize(label);
+    gp.LabelSizes.push_back(size);
+    gp.LabelSizeIndices.SetInt(key, gp.LabelSizes.Size);
+    return size;
+}
+
+// Compares ticks and labels of two tickers, except for what only locating or rendering fills in
+static bool TickersMatch(const ImPlotTicker& a, const ImPlotTicker& b) {
+    if (a.Ticks.Size != b.Ticks.Size || a.TextBuffer.Buf.Size != b.TextBuffer.Buf.Size || a.MaxSize.x != b.MaxSize.x ||
+        a.MaxSize.y != b.MaxSize.y || a.Levels != b.Levels)
+        return false;
+    for (int i = 0; i < a.Ticks.Size; ++i) {
+        const ImPlotTick& ta = a.Ticks[i];
+        const ImPlotTick& tb = b.Ticks[i];
+        if (ta.PlotPos != tb.PlotPos || ta.Major != tb.Major || ta.ShowLabel != tb.ShowLabel || ta.Level != tb.Level ||
+            ta.TextOffset != tb.TextOffset)
+            return false;
+    }
+    return a.TextBuffer.Buf.Size == 0 || memcmp(a.TextBuffer.Buf.Data, b.TextBuffer.Buf.Data, a.TextBuffer.Buf.Size) == 0;
+}
+
+// Checks the inputs of the locator of an axis and ticks added before locating against those of its cached ticker.
+// Formatters are expected to only depend on the formatted value and their data (and the default formatter on the
+// format string it points to).
+static bool TickerCacheMatches(const ImPlotAxis& axis, float pixels, bool vertical) {
+    ImPlotContext& gp = *GImPlot;
+    ImGuiContext& g = *GImGui;
+    const ImPlotTickerCache& cache = axis.TickerCache;
+    if (!cache.Valid || cache.Locator != axis.Locator || cache.Formatter != axis.Formatter ||
+        cache.FormatterData != axis.FormatterData || cache.Range.Min != axis.Range.Min ||
+        cache.Range.Max != axis.Range.Max || cache.Pixels != pixels || cache.Vertical != vertical ||
+        cache.Font != g.Font || cache.FontSize != g.FontSize || cache.UseLocalTime != gp.Style.UseLocalTime ||
+        cache.UseISO8601 != gp.Style.UseISO8601 || cache.Use24HourClock != gp.Style.Use24HourClock)
+        return false;
+    if (axis.Formatter == Formatter_Default && axis.FormatterData != nullptr &&
+        strcmp(cache.Format.Data, (const char*)axis.FormatterData) != 0)
+        return false;
+    return TickersMatch(cache.Input, axis.Ticker);
+}
+
+// Adds ticks of the locator of an axis, or ticks cached when it was last called with the same inputs
+static void LocateTicks(ImPlotAxis& axis, float pixels, bool vertical) {
+    if (TickerCacheMatches(axis, pixels, vertical)) {
+        axis.Ticker.CopyFrom(axis.TickerCache.Ticker);
+        return;
+    }
+    ImPlotContext& gp = *GImPlot;
+    ImGuiContext& g = *GImGui;
+    ImPlotTickerCache& cache = axis.TickerCache;
+    cache.Valid          = true;
+    cache.Locator        = axis.Locator;
+    cache.Formatter      = axis.Formatter;
+    cache.FormatterData  = axis.FormatterData;
+    cache.Range          = axis.Range;
+    cache.Pixels         = pixels;
+    cache.Vertical       = vertical;
+    cache.Font           = g.Font;
+    cache.FontSize       = g.FontSize;
+    cache.UseLocalTime   = gp.Style.UseLocalTime;
+    cache.UseISO8601     = gp.Style.UseISO8601;
+    cache.Use24HourClock = gp.Style.Use24HourClock;
+    cache.Format.resize(0);
+    if (axis.Formatter == Formatter_Default && axis.FormatterData != nullptr) {
+        const char* fmt = (const char*)axis.FormatterData;
+        cache.Format.resize((int)strlen(fmt) + 1);
+        memcpy(cache.Format.Data, fmt, (size_t)cache.Format.Size);
+    }
+    cache.Input.CopyFrom(axis.Ticker);
+    axis.Locator(axis.Ticker, axis.Range, pixels, vertical, axis.Formatter, axis.FormatterData);
+    cache.Ticker.CopyFrom(axis.Ticker);
+}
+
 //-----------------------------------------------------------------------------
 // Time Ticks and Utils
 //-----------------------------------------------------------------------------
@@ -2212,8 +2303,11 @@ void SetupAxisTicks(ImAxis idx, double v_min, double v_max, int n_ticks, const c
     IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr && !gp.CurrentPlot->SetupLocked,
                          "Setup needs to be called after BeginPlot and before any setup locking functions (e.g. PlotX)!");
     n_ticks = n_ticks < 2 ? 2 : n_ticks;
-    FillRange(gp.TempDouble1, n_ticks, v_min, v_max);
-    SetupAxisTicks(idx, gp.TempDouble1.Data, n_ticks, labels, show_default);
+    double* values = GImGui->FrameArena.AllocArray<double>(n_ticks);
+    const double step = (v_max - v_min) / (n_ticks - 1);
+    for (int i = 0; i < n_ticks; ++i)
+        values[i] = v_min + i * step;
+    SetupAxisTicks(idx, values, n_ticks, labels, show_default);
 }
 
 void SetupAxisScale(ImAxis idx, ImPlotScale scale) {
@@ -2571,7 +2665,7 @@ void SetupFinish() {
     for (int i = 0; i < IMPLOT_NUM_Y_AXES; i++) {
         ImPlotAxis& axis = plot.YAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks && plot_height > 0) {
-            axis.Locator(axis.Ticker, axis.Range, plot_height, true, axis.Formatter, axis.FormatterData);
+            LocateTicks(axis, plot_height, true);
         }
     }
 
@@ -2584,7 +2678,7 @@ void SetupFinish() {
     for (int i = 0; i < IMPLOT_NUM_X_AXES; i++) {
         ImPlotAxis& axis = plot.XAxis(i);
         if (axis.WillRender() && axis.ShowDefaultTicks && plot_width > 0) {
-            axis.Locator(axis.Ticker, axis.Range, plot_width, false, axis.Formatter, axis.FormatterData);
+            LocateTicks(axis, plot_width, false);
         }
     }
 
@@ -4862,6 +4956,18 @@ void PopPlotClipRect() {
     ImGui::PopClipRect();
 }
 
+void SetHeatmapTextureCallback(ImPlotHeatmapTextureCallback callback, void* user_data) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    GImPlot->HeatmapTextureCallback     = callback;
+    GImPlot->HeatmapTextureCallbackData = user_data;
+}
+
+void SetParallelForCallback(ImPlotParallelForCallback callback, void* user_data) {
+    IM_ASSERT_USER_ERROR(GImPlot != nullptr, "No current context. Did you call ImPlot::CreateContext() or ImPlot::SetCurrentContext()?");
+    GImPlot->ParallelForCallback     = callback;
+    GImPlot->ParallelForCallbackData = user_data;
+}
+
 static void HelpMarker(const char* desc) {
     ImGui::TextDisabled("(?)");
     if (ImGui::IsItemHovered()) {
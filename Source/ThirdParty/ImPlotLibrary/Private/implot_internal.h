@@ -59,6 +59,34 @@
 #define IMPLOT_LABEL_FORMAT "%g"
 // Max character size for tick labels
 #define IMPLOT_LABEL_MAX_SIZE 32
+// Number of samples in buckets of the finest level of line level-of-detail pyramids
+#define IMPLOT_LOD_BUCKET_SIZE 64
+// Maximum number of levels of line level-of-detail pyramids
+#define IMPLOT_LOD_MAX_LEVELS 24
+// Number of frames after which unused line level-of-detail pyramids are released
+#define IMPLOT_LOD_RELEASE_FRAMES 120
+// Maximum number of chunks into which primitives of one item are split when rendered in parallel
+#define IMPLOT_RENDER_MAX_CHUNKS 16
+// Minimum number of primitives in one chunk when rendering in parallel
+#define IMPLOT_RENDER_CHUNK_MIN_PRIMS 8192
+// Number of consecutive points transformed to pixel space at once by renderers
+#define IMPLOT_TRANSFORM_BLOCK_SIZE 128
+// Maximum number of blocks of transformed points used by one renderer (one per getter)
+#define IMPLOT_TRANSFORM_MAX_BLOCKS 2
+// Define to render every item rendered in parallel also serially and assert that both outputs are identical (enabled in
+// Unreal debug builds)
+//#define IMPLOT_DEBUG_PARALLEL_RENDER
+#if !defined(IMPLOT_DEBUG_PARALLEL_RENDER) && defined(UE_BUILD_DEBUG) && UE_BUILD_DEBUG
+#define IMPLOT_DEBUG_PARALLEL_RENDER
+#endif
+// Maximum number of chunks into which samples of one histogram are split when binned in parallel
+#define IMPLOT_HISTOGRAM_MAX_CHUNKS 16
+// Minimum number of samples in one chunk when binning in parallel
+#define IMPLOT_HISTOGRAM_CHUNK_MIN_SAMPLES 65536
+// Number of frames after which bin counts of histograms that are no longer plotted are released
+#define IMPLOT_HISTOGRAM_RELEASE_FRAMES 120
+// Maximum number of tick label sizes cached by the context before the cache is cleared
+#define IMPLOT_LABEL_SIZE_CACHE_MAX 4096
 
 //-----------------------------------------------------------------------------
 // [SECTION] Macros
@@ -149,6 +177,97 @@ static inline void ImMinMaxArray(const T* values, int count, T* min_out, T* max_
     }
     *min_out = Min; *max_out = Max;
 }
+#ifdef IMGUI_ENABLE_SSE
+// Same as above for floats and doubles, with the same handling of NaN: _mm_min/_mm_max return their second operand
+// (the running min/max here) if either is NaN, so NaN values are skipped unless values[0] is NaN
+static inline void ImMinMaxArray(const float* values, int count, float* min_out, float* max_out) {
+    __m128 vmin = _mm_set1_ps(values[0]), vmax = vmin;
+    int i = 1;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v = _mm_loadu_ps(values + i);
+        vmin = _mm_min_ps(v, vmin);
+        vmax = _mm_max_ps(v, vmax);
+    }
+    vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+    vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+    vmin = _mm_min_ss(vmin, _mm_shuffle_ps(vmin, vmin, 1));
+    vmax = _mm_max_ss(vmax, _mm_shuffle_ps(vmax, vmax, 1));
+    float Min = _mm_cvtss_f32(vmin), Max = _mm_cvtss_f32(vmax);
+    for (; i < count; ++i) {
+        if (values[i] < Min) { Min = values[i]; }
+        if (values[i] > Max) { Max = values[i]; }
+    }
+    *min_out = Min; *max_out = Max;
+}
+static inline void ImMinMaxArray(const double* values, int count, double* min_out, double* max_out) {
+    __m128d vmin = _mm_set1_pd(values[0]), vmax = vmin;
+    int i = 1;
+    for (; i + 2 <= count; i += 2) {
+        const __m128d v = _mm_loadu_pd(values + i);
+        vmin = _mm_min_pd(v, vmin);
+        vmax = _mm_max_pd(v, vmax);
+    }
+    vmin = _mm_min_sd(vmin, _mm_unpackhi_pd(vmin, vmin));
+    vmax = _mm_max_sd(vmax, _mm_unpackhi_pd(vmax, vmax));
+    double Min = _mm_cvtsd_f64(vmin), Max = _mm_cvtsd_f64(vmax);
+    for (; i < count; ++i) {
+        if (values[i] < Min) { Min = values[i]; }
+        if (values[i] > Max) { Max = values[i]; }
+    }
+    *min_out = Min; *max_out = Max;
+}
+#endif
+// Extends [min,max] with the finite values of an array
+template <typename T>
+static inline void ImMinMaxArrayFinite(const T* values, int count, double* min_inout, double* max_inout) {
+    double Min = *min_inout, Max = *max_inout;
+    for (int i = 0; i < count; ++i) {
+        const double v = (double)values[i];
+        if (!(v >= -DBL_MAX && v <= DBL_MAX)) { continue; }
+        if (v < Min) { Min = v; }
+        if (v > Max) { Max = v; }
+    }
+    *min_inout = Min; *max_inout = Max;
+}
+#ifdef IMGUI_ENABLE_SSE
+static inline void ImMinMaxArrayFinite(const double* values, int count, double* min_inout, double* max_inout) {
+    // non-finite values are replaced with infinities that can't change the result
+    const __m128d abs_mask = _mm_castsi128_pd(_mm_set1_epi64x(0x7FFFFFFFFFFFFFFFll));
+    const __m128d lim = _mm_set1_pd(DBL_MAX), pinf = _mm_set1_pd(INFINITY), ninf = _mm_set1_pd(-INFINITY);
+    __m128d vmin = pinf, vmax = ninf;
+    int i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128d v = _mm_loadu_pd(values + i);
+        const __m128d finite = _mm_cmple_pd(_mm_and_pd(v, abs_mask), lim);
+        vmin = _mm_min_pd(vmin, _mm_or_pd(_mm_and_pd(finite, v), _mm_andnot_pd(finite, pinf)));
+        vmax = _mm_max_pd(vmax, _mm_or_pd(_mm_and_pd(finite, v), _mm_andnot_pd(finite, ninf)));
+    }
+    vmin = _mm_min_sd(vmin, _mm_unpackhi_pd(vmin, vmin));
+    vmax = _mm_max_sd(vmax, _mm_unpackhi_pd(vmax, vmax));
+    *min_inout = ImMin(*min_inout, _mm_cvtsd_f64(vmin));
+    *max_inout = ImMax(*max_inout, _mm_cvtsd_f64(vmax));
+    ImMinMaxArrayFinite<double>(values + i, count - i, min_inout, max_inout);
+}
+static inline void ImMinMaxArrayFinite(const float* values, int count, double* min_inout, double* max_inout) {
+    const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+    const __m128 lim = _mm_set1_ps(FLT_MAX), pinf = _mm_set1_ps(INFINITY), ninf = _mm_set1_ps(-INFINITY);
+    __m128 vmin = pinf, vmax = ninf;
+    int i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128 v = _mm_loadu_ps(values + i);
+        const __m128 finite = _mm_cmple_ps(_mm_and_ps(v, abs_mask), lim);
+        vmin = _mm_min_ps(vmin, _mm_or_ps(_mm_and_ps(finite, v), _mm_andnot_ps(finite, pinf)));
+        vmax = _mm_max_ps(vmax, _mm_or_ps(_mm_and_ps(finite, v), _mm_andnot_ps(finite, ninf)));
+    }
+    vmin = _mm_min_ps(vmin, _mm_movehl_ps(vmin, vmin));
+    vmax = _mm_max_ps(vmax, _mm_movehl_ps(vmax, vmax));
+    vmin = _mm_min_ss(vmin, _mm_shuffle_ps(vmin, vmin, 1));
+    vmax = _mm_max_ss(vmax, _mm_shuffle_ps(vmax, vmax, 1));
+    *min_inout = ImMin(*min_inout, (double)_mm_cvtss_f32(vmin));
+    *max_inout = ImMax(*max_inout, (double)_mm_cvtss_f32(vmax));
+    ImMinMaxArrayFinite<float>(values + i, count - i, min_inout, max_inout);
+}
+#endif
 // Finds the sim of an array
 template <typename T>
 static inline T ImSum(const T* values, int count) {
@@ -550,6 +669,11 @@ struct ImPlotTick
     }
 };
 
+namespace ImPlot {
+// Measures a tick label with the current font, reusing sizes of recently measured labels
+IMPLOT_API ImVec2 CalcTickLabelSize(const char* label);
+}
+
 // Collection of ticks
 struct ImPlotTicker {
     ImVector<ImPlotTick> Ticks;
@@ -567,7 +691,7 @@ struct ImPlotTicker {
         if (show_label && label != nullptr) {
             tick.TextOffset = TextBuffer.size();
             TextBuffer.append(label, label + strlen(label) + 1);
-            tick.LabelSize = ImGui::CalcTextSize(TextBuffer.Buf.Data + tick.TextOffset);
+            tick.LabelSize = ImPlot::CalcTickLabelSize(TextBuffer.Buf.Data + tick.TextOffset);
         }
         return AddTick(tick);
     }
@@ -579,7 +703,7 @@ struct ImPlotTicker {
             tick.TextOffset = TextBuffer.size();
             formatter(tick.PlotPos, buff, sizeof(buff), data);
             TextBuffer.append(buff, buff + strlen(buff) + 1);
-            tick.LabelSize = ImGui::CalcTextSize(TextBuffer.Buf.Data + tick.TextOffset);
+            tick.LabelSize = ImPlot::CalcTickLabelSize(TextBuffer.Buf.Data + tick.TextOffset);
         }
         return AddTick(tick);
     }
@@ -618,6 +742,38 @@ struct ImPlotTicker {
     int TickCount() const {
         return Ticks.Size;
     }
+
+    // Copies ticks and labels without reallocating buffers that are large enough (LateSize is not copied)
+    void CopyFrom(const ImPlotTicker& other) {
+        Ticks.resize(other.Ticks.Size);
+        if (other.Ticks.Size > 0)
+            memcpy(Ticks.Data, other.Ticks.Data, other.Ticks.size_in_bytes());
+        TextBuffer.Buf.resize(other.TextBuffer.Buf.Size);
+        if (other.TextBuffer.Buf.Size > 0)
+            memcpy(TextBuffer.Buf.Data, other.TextBuffer.Buf.Data, other.TextBuffer.Buf.size_in_bytes());
+        MaxSize = other.MaxSize;
+        Levels  = other.Levels;
+    }
+};
+
+// Ticks of an axis after locating, reused while inputs of the locator don't change (see SetupFinish). The inputs are
+// stored and compared in full, so that a cached ticker is never reused for different inputs.
+struct ImPlotTickerCache {
+    bool            Valid;
+    ImPlotLocator   Locator;
+    ImPlotFormatter Formatter;
+    void*           FormatterData;
+    ImVector<char>  Format;         // copy of the format string of the default formatter (FormatterData)
+    ImPlotRange     Range;
+    float           Pixels;
+    bool            Vertical;
+    ImFont*         Font;
+    float           FontSize;
+    bool            UseLocalTime, UseISO8601, Use24HourClock;
+    ImPlotTicker    Input;          // ticks added before locating (e.g. custom ticks)
+    ImPlotTicker    Ticker;         // ticks after locating
+
+    ImPlotTickerCache() { Valid = false; }
 };
 
 // Axis state information that must persist after EndPlot
@@ -635,6 +791,7 @@ struct ImPlotAxis
     ImPlotRange          ConstraintZoom;
 
     ImPlotTicker         Ticker;
+    ImPlotTickerCache    TickerCache;
     ImPlotFormatter      Formatter;
     void*                FormatterData;
     char                 FormatSpec[16];
@@ -937,15 +1094,88 @@ struct ImPlotAlignmentData {
 };
 
 // State information for Plot items
+// Parameters of the data of one coordinate of a getter, used to detect how data of items with ImPlotItemFlags_CacheFit
+// changed (indexers of array data set Data, Offset and Stride, computed indexers set Params)
+struct ImPlotFitKey {
+    const void* Data;
+    double      Params[2];
+    int         Offset;
+    int         Stride;
+
+    ImPlotFitKey() {
+        Data      = nullptr;
+        Params[0] = Params[1] = 0;
+        Offset    = Stride = 0;
+    }
+
+    bool operator==(const ImPlotFitKey& other) const {
+        return Data == other.Data && Params[0] == other.Params[0] && Params[1] == other.Params[1]
+            && Offset == other.Offset && Stride == other.Stride;
+    }
+};
+
+// Extents of finite coordinates of the points of one getter (Min > Max if there are none)
+struct ImPlotFitSource {
+    ImPlotFitKey KeyX;
+    ImPlotFitKey KeyY;
+    int          Count;
+    ImPlotRange  X;
+    ImPlotRange  Y;
+
+    ImPlotFitSource() { Count = 0; }
+};
+
+// Fit extents of an item with ImPlotItemFlags_CacheFit, updated in every frame in which the item is submitted
+struct ImPlotFitCache {
+    ImPlotFitSource Sources[2];
+    int             LastFrame;
+
+    ImPlotFitCache() { LastFrame = -1; }
+};
+
+// Uniform grid over the finite points of an item with ImPlotItemFlags_Pickable, used by GetNearestItemPoint and
+// GetItemPointsInRect. Points are copied and sorted by cell (in row-major order), so points of one cell are contiguous.
+struct ImPlotPointIndex {
+    ImPlotFitKey          KeyX;
+    ImPlotFitKey          KeyY;
+    int                   Count;      // number of samples of indexed data, -1 if the index has to be rebuilt
+    ImAxis                XAxis;      // axes on which the item was plotted
+    ImAxis                YAxis;
+    ImPlotRect            Bounds;     // extents of indexed points
+    int                   CellsX;
+    int                   CellsY;
+    double                ScaleX;     // cells per unit (0 if all points have the same coordinate)
+    double                ScaleY;
+    ImVector<int>         CellStart;  // CellsX*CellsY+1 offsets to Points of first points of cells
+    ImVector<ImPlotPoint> Points;
+    ImVector<int>         Indices;    // sample index of each point
+    int                   LastFrame;  // frame in which the item was last plotted and indexed, queries fail on other frames
+
+    ImPlotPointIndex() {
+        Count  = -1;
+        LastFrame = -1;
+        XAxis  = ImAxis_X1;
+        YAxis  = ImAxis_Y1;
+        CellsX = CellsY = 0;
+        ScaleX = ScaleY = 0;
+    }
+
+    // coordinates are clamped to the grid, so they must not be NaN
+    int GetCellX(double x) const { return (int)ImClamp((x - Bounds.X.Min) * ScaleX, 0.0, CellsX - 1.0); }
+    int GetCellY(double y) const { return (int)ImClamp((y - Bounds.Y.Min) * ScaleY, 0.0, CellsY - 1.0); }
+};
+
 struct ImPlotItem
 {
-    ImGuiID      ID;
-    ImU32        Color;
-    ImRect       LegendHoverRect;
-    int          NameOffset;
-    bool         Show;
-    bool         LegendHovered;
-    bool         SeenThisFrame;
+    ImGuiID          ID;
+    ImU32            Color;
+    ImRect           LegendHoverRect;
+    int              NameOffset;
+    bool             Show;
+    bool             LegendHovered;
+    bool             SeenThisFrame;
+    ImPlotFitCache   FitCache;
+    ImPlotPointIndex PointIndex;
 
     ImPlotItem() {
         ID            = 0;
@@ -1190,6 +1420,7 @@ struct ImPlotNextItemData {
     bool            HasHidden;
     bool            Hidden;
     ImPlotCond      HiddenCond;
+    int             AppendedCount;
     ImPlotNextItemData() { Reset(); }
     void Reset() {
         for (int i = 0; i < 5; ++i)
@@ -1197,9 +1428,76 @@ struct ImPlotNextItemData {
         LineWeight    = MarkerSize = MarkerWeight = FillAlpha = ErrorBarSize = ErrorBarWeight = DigitalBitHeight = DigitalBitGap = IMPLOT_AUTO;
         Marker        = IMPLOT_AUTO;
         HasHidden     = Hidden = false;
+        AppendedCount = 0;
+    }
+};
+
+// Bucket of a line level-of-detail pyramid, holding indices of its extreme samples (-1 if all samples are NaN)
+struct ImPlotLodBucket {
+    int  Min;
+    int  Max;
+    bool HasNaN;
+};
+
+// Retained min/max pyramid of a line series, used by ImPlotLineFlags_DecimateRetained to decimate large series without
+// reading all of their samples. Level L holds buckets of IMPLOT_LOD_BUCKET_SIZE << L samples (only full buckets are
+// stored, so appended samples only add buckets at the end of each level).
+struct ImPlotLineLod {
+    const void*               Data;
+    int                       Stride;
+    int                       Count;
+    double                    LastY;
+    int                       LastFrame;
+    ImVector<ImPlotLodBucket> Levels[IMPLOT_LOD_MAX_LEVELS];
+
+    ImPlotLineLod() {
+        Data      = nullptr;
+        Stride    = 0;
+        Count     = 0;
+        LastY     = 0;
+        LastFrame = 0;
     }
 };
 
+// Bin counts of a histogram, before cumulative sums and normalization. Histograms with ImPlotHistogramFlags_Cached keep
+// counts between frames, so they are only recomputed when data or bins change, and samples appended to data are binned
+// into existing counts as long as they don't change the bins.
+struct ImPlotHistogramCache {
+    const void*   Data[2];     // values or xs, and ys of 2D histograms
+    int           Count;       // number of binned samples, -1 if counts must be recomputed
+    int           BinsSpec[2]; // requested bins (count or ImPlotBin_)
+    ImPlotRect    RangeSpec;   // requested range (zero if taken from data)
+    int           Bins[2];
+    ImPlotRect    Range;
+    double        Width[2];
+    ImVector<int> Counts;
+    int           Counted;     // samples within range
+    int           Below;       // samples below range (only counted by 1D histograms)
+    int           LastFrame;
+
+    ImPlotHistogramCache() {
+        Data[0]     = Data[1] = nullptr;
+        Count       = -1;
+        BinsSpec[0] = BinsSpec[1] = 0;
+        Bins[0]     = Bins[1] = 0;
+        Width[0]    = Width[1] = 0;
+        Counted     = Below = 0;
+        LastFrame   = 0;
+    }
+};
+
+// Range of primitives rendered by one task of parallel rendering, with vertices and indices relative to the chunk start
+struct ImPlotRenderChunk {
+    ImVector<ImDrawVert> VtxBuffer;
+    ImVector<ImDrawIdx>  IdxBuffer;
+    int                  PrimBegin;
+    int                  PrimEnd;
+    int                  PrimsRendered;
+    ImVec2               TransformBuffer[IMPLOT_TRANSFORM_MAX_BLOCKS * IMPLOT_TRANSFORM_BLOCK_SIZE]; // points transformed by the renderer of the chunk
+
+    ImPlotRenderChunk() { PrimBegin = PrimEnd = PrimsRendered = 0; }
+};
+
 // Holds state information that must persist between calls to BeginPlot()/EndPlot()
 struct ImPlotContext {
     // Plot States
@@ -1212,7 +1510,9 @@ struct ImPlotContext {
     ImPlotItem*           PreviousItem;
 
     // Tick Marks and Labels
-    ImPlotTicker CTicker;
+    ImPlotTicker     CTicker;
+    ImGuiStorage     LabelSizeIndices; // hash of font and label -> index of size in LabelSizes + 1
+    ImVector<ImVec2> LabelSizes;
 
     // Annotation and Tabs
     ImPlotAnnotationCollection Annotations;
@@ -1228,9 +1528,29 @@ struct ImPlotContext {
     // Time
     tm Tm;
 
-    // Temp data for general use
-    ImVector<double>   TempDouble1, TempDouble2;
-    ImVector<int>      TempInt1;
+    // Temp arrays for general use are allocated from ImGuiContext::FrameArena
+
+    // Decimation data
+    ImVector<int>         DecimatedIndices;
+    ImBitVector           DecimationGrid;
+    ImPool<ImPlotLineLod> LineLods;
+    int                   LineLodSweepFrame;
+
+    // Histogram data
+    ImPool<ImPlotHistogramCache> Histograms;
+    int                          HistogramSweepFrame;
+    ImPlotHistogramCache         TempHistogram; // counts of histograms without ImPlotHistogramFlags_Cached
+
+    // Heatmap textures
+    ImPlotHeatmapTextureCallback HeatmapTextureCallback;
+    void*                        HeatmapTextureCallbackData;
+    ImVector<ImU32>              HeatmapPixels;
+
+    // Parallel rendering
+    ImPlotParallelForCallback ParallelForCallback;
+    void*                     ParallelForCallbackData;
+    ImPlotRenderChunk         RenderChunks[IMPLOT_RENDER_MAX_CHUNKS];
+    ImVec2                    TransformBuffer[IMPLOT_TRANSFORM_MAX_BLOCKS * IMPLOT_TRANSFORM_BLOCK_SIZE]; // points transformed by the renderer of serial rendering
 
     // Misc
     int                DigitalPlotItemCnt;
@@ -1312,12 +1632,34 @@ IMPLOT_API void ShowSubplotsContextMenu(ImPlotSubplot& subplot);
 IMPLOT_API bool BeginItem(const char* label_id, ImPlotItemFlags flags=0, ImPlotCol recolor_from=IMPLOT_AUTO);
 
 // Same as above but with fitting functionality.
+// Updates cached fit extents of the current item. Returns false if fitter doesn't support caching (see overloads in
+// implot_items.cpp).
+template <typename _Fitter>
+static inline bool UpdateFitCache(const _Fitter&, ImPlotFitCache&) { return false; }
+// Extends axes with cached fit extents. Returns false if points need to be fitted one by one.
+template <typename _Fitter>
+static inline bool ApplyFitCache(const _Fitter&, const ImPlotFitCache&, ImPlotAxis&, ImPlotAxis&) { return false; }
+
+// Updates the point index of the current item. Only points of items with a single getter are indexed (see overloads
+// in implot_items.cpp).
+template <typename _Fitter>
+static inline void UpdatePointIndex(const _Fitter&, ImPlotPointIndex& index) { index = ImPlotPointIndex(); }
+
 template <typename _Fitter>
 bool BeginItemEx(const char* label_id, const _Fitter& fitter, ImPlotItemFlags flags=0, ImPlotCol recolor_from=IMPLOT_AUTO) {
     if (BeginItem(label_id, flags, recolor_from)) {
         ImPlotPlot& plot = *GetCurrentPlot();
-        if (plot.FitThisFrame && !ImHasFlag(flags, ImPlotItemFlags_NoFit))
-            fitter.Fit(plot.Axes[plot.CurrentX], plot.Axes[plot.CurrentY]);
+        if (!ImHasFlag(flags, ImPlotItemFlags_NoFit)) {
+            ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+            ImPlotAxis& y_axis = plot.Axes[plot.CurrentY];
+            // cache is updated even if not fitting, because appended samples are only reported once
+            ImPlotFitCache& cache = GImPlot->CurrentItem->FitCache;
+            const bool cached = ImHasFlag(flags, ImPlotItemFlags_CacheFit) && UpdateFitCache(fitter, cache);
+            if (plot.FitThisFrame && !(cached && ApplyFitCache(fitter, cache, x_axis, y_axis)))
+                fitter.Fit(x_axis, y_axis);
+        }
+        if (ImHasFlag(flags, ImPlotItemFlags_Pickable))
+            UpdatePointIndex(fitter, GImPlot->CurrentItem->PointIndex);
         return true;
     }
     return false;
@@ -60,6 +60,16 @@ static IMPLOT_INLINE float  ImInvSqrt(float x) { return _mm_cvtss_f32(_mm_rsqrt_
 static IMPLOT_INLINE float  ImInvSqrt(float x) { return 1.0f / sqrtf(x); }
 #endif
 
+// Vectorized transforms of points on linear axes. x86 uses SSE2 rather than AVX2: SSE2 is part of x86-64 and already
+// required by Dear ImGui, while AVX2 is not enabled in default engine builds and would need runtime dispatch. Each
+// block is gathered from getters into double arrays first, which costs more than the two-wide arithmetic.
+#if defined __SSE2__ || defined __x86_64__ || defined _M_X64
+#define IMPLOT_TRANSFORM_SSE
+#elif defined __aarch64__ || defined _M_ARM64
+#include <arm_neon.h>
+#define IMPLOT_TRANSFORM_NEON
+#endif
+
 #define IMPLOT_NORMALIZE2F_OVER_ZERO(VX,VY) do { float d2 = VX*VX + VY*VY; if (d2 > 0.0f) { float inv_len = ImInvSqrt(d2); VX *= inv_len; VY *= inv_len; } } while (0)
 
 // Support for pre-1.82 versions. Users on 1.82+ can use 0 (default) flags to mean "all corners" but in order to support older versions we are more explicit.
@@ -319,6 +329,79 @@ ImPlotItem* GetCurrentItem() {
     return gp.CurrentItem;
 }
 
+// Gets the range of cells of a point index that overlap a rectangle. Returns false if there are none or if the index
+// wasn't built in this frame (e.g. the item isn't pickable or wasn't plotted yet), so it may not match the item's data.
+static bool GetPointIndexCells(const ImPlotPointIndex& index, const ImPlotRect& rect, int* cx1, int* cy1, int* cx2, int* cy2) {
+    if (index.LastFrame != ImGui::GetFrameCount() || index.Points.empty() || !(rect.X.Min <= index.Bounds.X.Max && rect.X.Max >= index.Bounds.X.Min &&
+                                  rect.Y.Min <= index.Bounds.Y.Max && rect.Y.Max >= index.Bounds.Y.Min))
+        return false;
+    *cx1 = index.GetCellX(rect.X.Min);
+    *cx2 = index.GetCellX(rect.X.Max);
+    *cy1 = index.GetCellY(rect.Y.Min);
+    *cy2 = index.GetCellY(rect.Y.Max);
+    return true;
+}
+
+int GetNearestItemPoint(const char* label_id, float radius, ImPlotPoint* point) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "GetNearestItemPoint() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    ImPlotItem* item = GetItem(label_id);
+    if (item == nullptr || !item->Show)
+        return -1;
+    const ImPlotPointIndex& index = item->PointIndex;
+    const ImPlotAxis& x_axis = gp.CurrentPlot->Axes[index.XAxis];
+    const ImPlotAxis& y_axis = gp.CurrentPlot->Axes[index.YAxis];
+    const ImVec2 mouse = ImGui::GetIO().MousePos;
+    // only cells overlapping the square around the cursor can contain points within radius
+    const double x1 = x_axis.PixelsToPlot(mouse.x - radius), x2 = x_axis.PixelsToPlot(mouse.x + radius);
+    const double y1 = y_axis.PixelsToPlot(mouse.y - radius), y2 = y_axis.PixelsToPlot(mouse.y + radius);
+    int cx1, cy1, cx2, cy2;
+    if (!GetPointIndexCells(index, ImPlotRect(ImMin(x1,x2), ImMax(x1,x2), ImMin(y1,y2), ImMax(y1,y2)), &cx1, &cy1, &cx2, &cy2))
+        return -1;
+    int nearest = -1;
+    float nearest_d2 = radius * radius;
+    for (int cy = cy1; cy <= cy2; ++cy) {
+        const int row = cy * index.CellsX;
+        for (int i = index.CellStart[row + cx1]; i < index.CellStart[row + cx2 + 1]; ++i) {
+            const float dx = x_axis.PlotToPixels(index.Points[i].x) - mouse.x;
+            const float dy = y_axis.PlotToPixels(index.Points[i].y) - mouse.y;
+            const float d2 = dx * dx + dy * dy;
+            if (d2 <= nearest_d2) {
+                nearest_d2 = d2;
+                nearest    = i;
+            }
+        }
+    }
+    if (nearest < 0)
+        return -1;
+    if (point != nullptr)
+        *point = index.Points[nearest];
+    return index.Indices[nearest];
+}
+
+int GetItemPointsInRect(const char* label_id, const ImPlotRect& rect, ImVector<int>* indices) {
+    ImPlotContext& gp = *GImPlot;
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "GetItemPointsInRect() needs to be called between BeginPlot() and EndPlot()!");
+    SetupLock();
+    ImPlotItem* item = GetItem(label_id);
+    if (item == nullptr || !item->Show)
+        return 0;
+    const ImPlotPointIndex& index = item->PointIndex;
+    int cx1, cy1, cx2, cy2;
+    if (!GetPointIndexCells(index, rect, &cx1, &cy1, &cx2, &cy2))
+        return 0;
+    const int size = indices->Size;
+    for (int cy = cy1; cy <= cy2; ++cy) {
+        const int row = cy * index.CellsX;
+        for (int i = index.CellStart[row + cx1]; i < index.CellStart[row + cx2 + 1]; ++i) {
+            if (rect.Contains(index.Points[i]))
+                indices->push_back(index.Indices[i]);
+        }
+    }
+    return indices->Size - size;
+}
+
 void SetNextLineStyle(const ImVec4& col, float weight) {
     ImPlotContext& gp = *GImPlot;
     gp.NextItemData.Colors[ImPlotCol_Line] = col;
@@ -347,6 +430,11 @@ void SetNextErrorBarStyle(const ImVec4& col, float size, float weight) {
     gp.NextItemData.ErrorBarWeight             = weight;
 }
 
+void SetNextItemAppended(int count) {
+    ImPlotContext& gp = *GImPlot;
+    gp.NextItemData.AppendedCount = count;
+}
+
 ImVec4 GetLastItemColor() {
     ImPlotContext& gp = *GImPlot;
     if (gp.PreviousItem)
@@ -551,6 +639,65 @@ struct IndexerConst {
     const double Ref;
 };
 
+/// Indexes samples of a ring buffer, starting at #head and wrapping around at #capacity (indices must be less than capacity)
+template <typename T>
+struct IndexerRing {
+    IndexerRing(const T* data, int capacity, int head, int stride = sizeof(T)) :
+        Data(data),
+        Capacity(capacity),
+        Head(capacity ? ImPosMod(head, capacity) : 0),
+        Stride(stride)
+    { }
+    template <typename I> IMPLOT_INLINE double operator()(I idx) const {
+        int i = Head + (int)idx;
+        if (i >= Capacity)
+            i -= Capacity;
+        return (double)*(const T*)(const void*)((const unsigned char*)Data + (size_t)i * Stride);
+    }
+    const T* Data;
+    int Capacity;
+    int Head;
+    int Stride;
+};
+
+/// Reads values of consecutive indices of an indexer
+template <typename _Indexer>
+IMPLOT_INLINE void IndexBlock(const _Indexer& indexer, int first, int count, double* out) {
+    for (int i = 0; i < count; ++i)
+        out[i] = indexer(first + i);
+}
+
+template <typename T>
+IMPLOT_INLINE void IndexBlock(const IndexerIdx<T>& indexer, int first, int count, double* out) {
+    if (indexer.Offset == 0 && indexer.Stride == sizeof(T)) {
+        const T* data = indexer.Data + first;
+        for (int i = 0; i < count; ++i)
+            out[i] = (double)data[i];
+    }
+    else {
+        for (int i = 0; i < count; ++i)
+            out[i] = indexer(first + i);
+    }
+}
+
+template <typename T>
+IMPLOT_INLINE void IndexBlock(const IndexerRing<T>& indexer, int first, int count, double* out) {
+    if (indexer.Stride == sizeof(T)) {
+        // at most two contiguous runs, before and after wrapping around
+        const int start = (indexer.Head + first) % indexer.Capacity;
+        const int run   = ImMin(count, indexer.Capacity - start);
+        const T* data   = indexer.Data + start;
+        for (int i = 0; i < run; ++i)
+            out[i] = (double)data[i];
+        for (int i = run; i < count; ++i)
+            out[i] = (double)indexer.Data[i - run];
+    }
+    else {
+        for (int i = 0; i < count; ++i)
+            out[i] = indexer(first + i);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Getters
 //-----------------------------------------------------------------------------
@@ -618,6 +765,26 @@ struct GetterLoop {
     const int Count;
 };
 
+/// Selects a subset of points of another getter (e.g. after decimation)
+template <typename _Getter>
+struct GetterIndexed {
+    GetterIndexed(const _Getter& getter, const int* indices, int count) : Getter(getter), Indices(indices), Count(count) { }
+    template <typename I> IMPLOT_INLINE ImPlotPoint operator()(I idx) const {
+        return Getter(Indices[idx]);
+    }
+    const _Getter Getter;
+    const int* const Indices;
+    const int Count;
+};
+
+/// Getters that only read user arrays can be evaluated from multiple threads (unlike user callbacks)
+template <typename _Getter> struct IsConcurrentGetter { static const bool Value = false; };
+template <typename _IndexerX, typename _IndexerY> struct IsConcurrentGetter<GetterXY<_IndexerX,_IndexerY>> { static const bool Value = true; };
+template <typename _Getter> struct IsConcurrentGetter<GetterOverrideX<_Getter>> : IsConcurrentGetter<_Getter> { };
+template <typename _Getter> struct IsConcurrentGetter<GetterOverrideY<_Getter>> : IsConcurrentGetter<_Getter> { };
+template <typename _Getter> struct IsConcurrentGetter<GetterLoop<_Getter>>      : IsConcurrentGetter<_Getter> { };
+template <typename _Getter> struct IsConcurrentGetter<GetterIndexed<_Getter>>   : IsConcurrentGetter<_Getter> { };
+
 template <typename T>
 struct GetterError {
     GetterError(const T* xs, const T* ys, const T* neg, const T* pos, int count, int offset, int stride) :
@@ -768,6 +935,299 @@ struct FitterRect {
     const ImPlotPoint Pmax;
 };
 
+// Fit caches of items with ImPlotItemFlags_CacheFit (see BeginItemEx). Cached extents are equivalent to fitting points
+// one by one only for getters of array data or linear/constant indexers.
+
+template <typename T>
+IMPLOT_INLINE bool GetFitKey(const IndexerIdx<T>& indexer, ImPlotFitKey& key) {
+    key.Data      = indexer.Data;
+    key.Params[0] = sizeof(T);
+    key.Offset    = indexer.Offset;
+    key.Stride    = indexer.Stride;
+    return true;
+}
+
+template <typename T>
+IMPLOT_INLINE bool GetFitKey(const IndexerRing<T>& indexer, ImPlotFitKey& key) {
+    key.Data      = indexer.Data;
+    key.Params[0] = sizeof(T);
+    key.Params[1] = indexer.Capacity;
+    key.Offset    = indexer.Head;
+    key.Stride    = indexer.Stride;
+    return true;
+}
+
+IMPLOT_INLINE bool GetFitKey(const IndexerLin& indexer, ImPlotFitKey& key) {
+    key.Params[0] = indexer.M;
+    key.Params[1] = indexer.B;
+    return true;
+}
+
+IMPLOT_INLINE bool GetFitKey(const IndexerConst& indexer, ImPlotFitKey& key) {
+    key.Params[0] = indexer.Ref;
+    return true;
+}
+
+template <typename _Indexer>
+IMPLOT_INLINE bool GetFitKey(const _Indexer&, ImPlotFitKey&) {
+    return false;
+}
+
+static const int FIT_BLOCK_SIZE = 256;
+
+/// Extends range with finite values of indices [first,last) of an indexer
+template <typename _Indexer>
+void FitIndexer(const _Indexer& indexer, int first, int last, ImPlotRange& range) {
+    double values[FIT_BLOCK_SIZE];
+    for (int i = first; i < last; i += FIT_BLOCK_SIZE) {
+        const int count = ImMin(FIT_BLOCK_SIZE, last - i);
+        IndexBlock(indexer, i, count, values);
+        ImMinMaxArrayFinite(values, count, &range.Min, &range.Max);
+    }
+}
+
+template <typename T>
+void FitIndexer(const IndexerIdx<T>& indexer, int first, int last, ImPlotRange& range) {
+    if (indexer.Offset == 0 && indexer.Stride == sizeof(T)) {
+        if (first < last)
+            ImMinMaxArrayFinite(indexer.Data + first, last - first, &range.Min, &range.Max);
+        return;
+    }
+    double values[FIT_BLOCK_SIZE];
+    for (int i = first; i < last; i += FIT_BLOCK_SIZE) {
+        const int count = ImMin(FIT_BLOCK_SIZE, last - i);
+        IndexBlock(indexer, i, count, values);
+        ImMinMaxArrayFinite(values, count, &range.Min, &range.Max);
+    }
+}
+
+IMPLOT_INLINE void FitIndexer(const IndexerConst& indexer, int first, int last, ImPlotRange& range) {
+    if (first < last)
+        ImMinMaxArrayFinite(&indexer.Ref, 1, &range.Min, &range.Max);
+}
+
+/// Updates cached extents of the first #count points of a getter. Only samples that were not in the cached extents are
+/// read: those reported with SetNextItemAppended or those added to the end of data with no offset.
+template <typename _IndexerX, typename _IndexerY>
+bool UpdateFitSource(ImPlotFitSource& source, const GetterXY<_IndexerX,_IndexerY>& getter, int count, bool valid) {
+    ImPlotFitKey key_x, key_y;
+    if (!GetFitKey(getter.IndxerX, key_x) || !GetFitKey(getter.IndxerY, key_y))
+        return false;
+    const int appended = GImPlot->NextItemData.AppendedCount;
+    const bool same_data = key_x == source.KeyX && key_y == source.KeyY;
+    int first = 0;
+    if (valid && same_data && count >= source.Count && key_x.Offset == 0 && key_y.Offset == 0)
+        first = source.Count;
+    else if (valid && count == source.Count && appended > 0)
+        first = ImMax(count - appended, 0);
+    if (first == 0)
+        source.X = source.Y = ImPlotRange(INFINITY, -INFINITY);
+    FitIndexer(getter.IndxerX, first, count, source.X);
+    FitIndexer(getter.IndxerY, first, count, source.Y);
+    source.KeyX  = key_x;
+    source.KeyY  = key_y;
+    source.Count = count;
+    return true;
+}
+
+/// Cached extents of a fit source (shifted by #dx, #dy) give the same fit as its points only if they're not affected by
+/// axis constraints or ImPlotAxisFlags_RangeFit
+IMPLOT_INLINE bool CanApplyFitSource(const ImPlotFitSource& source, double dx, double dy, const ImPlotAxis& x_axis, const ImPlotAxis& y_axis) {
+    if (ImHasFlag(x_axis.Flags, ImPlotAxisFlags_RangeFit) || ImHasFlag(y_axis.Flags, ImPlotAxisFlags_RangeFit))
+        return false;
+    if (source.X.Min <= source.X.Max && (source.X.Min + dx < x_axis.ConstraintRange.Min || source.X.Max + dx > x_axis.ConstraintRange.Max))
+        return false;
+    if (source.Y.Min <= source.Y.Max && (source.Y.Min + dy < y_axis.ConstraintRange.Min || source.Y.Max + dy > y_axis.ConstraintRange.Max))
+        return false;
+    return true;
+}
+
+IMPLOT_INLINE void ApplyFitSource(const ImPlotFitSource& source, double dx, double dy, ImPlotAxis& x_axis, ImPlotAxis& y_axis) {
+    if (source.X.Min <= source.X.Max) {
+        x_axis.ExtendFit(source.X.Min + dx);
+        x_axis.ExtendFit(source.X.Max + dx);
+    }
+    if (source.Y.Min <= source.Y.Max) {
+        y_axis.ExtendFit(source.Y.Min + dy);
+        y_axis.ExtendFit(source.Y.Max + dy);
+    }
+}
+
+/// Returns true if cached extents are up to date with data from the previous frame (appended samples are only reported
+/// in the frame in which they are appended, so extents cached before a skipped frame can't be extended)
+IMPLOT_INLINE bool IsFitCacheValid(const ImPlotFitCache& cache) {
+    const int frame = ImGui::GetFrameCount();
+    return cache.LastFrame == frame - 1 || cache.LastFrame == frame;
+}
+
+template <typename _IndexerX, typename _IndexerY>
+bool UpdateFitCache(const Fitter1<GetterXY<_IndexerX,_IndexerY>>& fitter, ImPlotFitCache& cache) {
+    if (!UpdateFitSource(cache.Sources[0], fitter.Getter, fitter.Getter.Count, IsFitCacheValid(cache)))
+        return false;
+    cache.LastFrame = ImGui::GetFrameCount();
+    return true;
+}
+
+template <typename _IndexerX, typename _IndexerY>
+bool ApplyFitCache(const Fitter1<GetterXY<_IndexerX,_IndexerY>>&, const ImPlotFitCache& cache, ImPlotAxis& x_axis, ImPlotAxis& y_axis) {
+    if (!CanApplyFitSource(cache.Sources[0], 0, 0, x_axis, y_axis))
+        return false;
+    ApplyFitSource(cache.Sources[0], 0, 0, x_axis, y_axis);
+    return true;
+}
+
+template <typename _IndexerX1, typename _IndexerY1, typename _IndexerX2, typename _IndexerY2>
+bool UpdateFitCache(const Fitter2<GetterXY<_IndexerX1,_IndexerY1>,GetterXY<_IndexerX2,_IndexerY2>>& fitter, ImPlotFitCache& cache) {
+    const bool valid = IsFitCacheValid(cache);
+    if (!UpdateFitSource(cache.Sources[0], fitter.Getter1, fitter.Getter1.Count, valid) ||
+        !UpdateFitSource(cache.Sources[1], fitter.Getter2, fitter.Getter2.Count, valid))
+        return false;
+    cache.LastFrame = ImGui::GetFrameCount();
+    return true;
+}
+
+template <typename _IndexerX1, typename _IndexerY1, typename _IndexerX2, typename _IndexerY2>
+bool ApplyFitCache(const Fitter2<GetterXY<_IndexerX1,_IndexerY1>,GetterXY<_IndexerX2,_IndexerY2>>&, const ImPlotFitCache& cache, ImPlotAxis& x_axis, ImPlotAxis& y_axis) {
+    if (!CanApplyFitSource(cache.Sources[0], 0, 0, x_axis, y_axis) || !CanApplyFitSource(cache.Sources[1], 0, 0, x_axis, y_axis))
+        return false;
+    ApplyFitSource(cache.Sources[0], 0, 0, x_axis, y_axis);
+    ApplyFitSource(cache.Sources[1], 0, 0, x_axis, y_axis);
+    return true;
+}
+
+template <typename _IndexerX1, typename _IndexerY1, typename _IndexerX2, typename _IndexerY2>
+bool UpdateFitCache(const FitterBarV<GetterXY<_IndexerX1,_IndexerY1>,GetterXY<_IndexerX2,_IndexerY2>>& fitter, ImPlotFitCache& cache) {
+    const bool valid = IsFitCacheValid(cache);
+    const int count = ImMin(fitter.Getter1.Count, fitter.Getter2.Count);
+    if (!UpdateFitSource(cache.Sources[0], fitter.Getter1, count, valid) ||
+        !UpdateFitSource(cache.Sources[1], fitter.Getter2, count, valid))
+        return false;
+    cache.LastFrame = ImGui::GetFrameCount();
+    return true;
+}
+
+template <typename _IndexerX1, typename _IndexerY1, typename _IndexerX2, typename _IndexerY2>
+bool ApplyFitCache(const FitterBarV<GetterXY<_IndexerX1,_IndexerY1>,GetterXY<_IndexerX2,_IndexerY2>>& fitter, const ImPlotFitCache& cache, ImPlotAxis& x_axis, ImPlotAxis& y_axis) {
+    if (!CanApplyFitSource(cache.Sources[0], -fitter.HalfWidth, 0, x_axis, y_axis) || !CanApplyFitSource(cache.Sources[1], fitter.HalfWidth, 0, x_axis, y_axis))
+        return false;
+    ApplyFitSource(cache.Sources[0], -fitter.HalfWidth, 0, x_axis, y_axis);
+    ApplyFitSource(cache.Sources[1], fitter.HalfWidth, 0, x_axis, y_axis);
+    return true;
+}
+
+template <typename _IndexerX1, typename _IndexerY1, typename _IndexerX2, typename _IndexerY2>
+bool UpdateFitCache(const FitterBarH<GetterXY<_IndexerX1,_IndexerY1>,GetterXY<_IndexerX2,_IndexerY2>>& fitter, ImPlotFitCache& cache) {
+    const bool valid = IsFitCacheValid(cache);
+    const int count = ImMin(fitter.Getter1.Count, fitter.Getter2.Count);
+    if (!UpdateFitSource(cache.Sources[0], fitter.Getter1, count, valid) ||
+        !UpdateFitSource(cache.Sources[1], fitter.Getter2, count, valid))
+        return false;
+    cache.LastFrame = ImGui::GetFrameCount();
+    return true;
+}
+
+template <typename _IndexerX1, typename _IndexerY1, typename _IndexerX2, typename _IndexerY2>
+bool ApplyFitCache(const FitterBarH<GetterXY<_IndexerX1,_IndexerY1>,GetterXY<_IndexerX2,_IndexerY2>>& fitter, const ImPlotFitCache& cache, ImPlotAxis& x_axis, ImPlotAxis& y_axis) {
+    if (!CanApplyFitSource(cache.Sources[0], 0, -fitter.HalfHeight, x_axis, y_axis) || !CanApplyFitSource(cache.Sources[1], 0, fitter.HalfHeight, x_axis, y_axis))
+        return false;
+    ApplyFitSource(cache.Sources[0], 0, -fitter.HalfHeight, x_axis, y_axis);
+    ApplyFitSource(cache.Sources[1], 0, fitter.HalfHeight, x_axis, y_axis);
+    return true;
+}
+
+// Point indices of items with ImPlotItemFlags_Pickable (see BeginItemEx). Indices are only kept while data of getters
+// of array data or linear/constant indexers is unchanged, and are rebuilt in every frame for other getters.
+
+static const int POINT_INDEX_CELL_POINTS = 4;    // average number of points per cell
+static const int POINT_INDEX_MAX_CELLS   = 1024; // maximal number of cells along one axis
+
+template <typename _Getter>
+IMPLOT_INLINE bool GetPointIndexKeys(const _Getter&, ImPlotFitKey&, ImPlotFitKey&) {
+    return false;
+}
+
+template <typename _IndexerX, typename _IndexerY>
+IMPLOT_INLINE bool GetPointIndexKeys(const GetterXY<_IndexerX,_IndexerY>& getter, ImPlotFitKey& key_x, ImPlotFitKey& key_y) {
+    return GetFitKey(getter.IndxerX, key_x) && GetFitKey(getter.IndxerY, key_y);
+}
+
+/// Sorts points of an index into cells of a grid over their extents (counting sort by cell)
+static void SortPointIndex(ImPlotPointIndex& index) {
+    const int count = index.Points.Size;
+    ImPlotRect& bounds = index.Bounds;
+    bounds = ImPlotRect(INFINITY, -INFINITY, INFINITY, -INFINITY);
+    for (int i = 0; i < count; ++i) {
+        bounds.X.Min = ImMin(bounds.X.Min, index.Points[i].x);
+        bounds.X.Max = ImMax(bounds.X.Max, index.Points[i].x);
+        bounds.Y.Min = ImMin(bounds.Y.Min, index.Points[i].y);
+        bounds.Y.Max = ImMax(bounds.Y.Max, index.Points[i].y);
+    }
+    const int cells = ImClamp((int)ImSqrt((float)count / POINT_INDEX_CELL_POINTS), 1, POINT_INDEX_MAX_CELLS);
+    const double w = bounds.X.Size();
+    const double h = bounds.Y.Size();
+    index.CellsX = w > 0 ? cells : 1;
+    index.CellsY = h > 0 ? cells : 1;
+    index.ScaleX = w > 0 ? index.CellsX / w : 0;
+    index.ScaleY = h > 0 ? index.CellsY / h : 0;
+
+    ImVector<int>& start = index.CellStart;
+    start.resize(index.CellsX * index.CellsY + 1);
+    memset(start.Data, 0, start.size_in_bytes());
+    int* point_cells = GImGui->FrameArena.AllocArray<int>(count);
+    for (int i = 0; i < count; ++i) {
+        point_cells[i] = index.GetCellY(index.Points[i].y) * index.CellsX + index.GetCellX(index.Points[i].x);
+        start[point_cells[i] + 1]++;
+    }
+    for (int c = 1; c < start.Size; ++c)
+        start[c] += start[c - 1];
+
+    ImVector<ImPlotPoint> points;
+    ImVector<int> indices;
+    points.resize(count);
+    indices.resize(count);
+    for (int i = 0; i < count; ++i) {
+        const int j = start[point_cells[i]]++;
+        points[j]  = index.Points[i];
+        indices[j] = index.Indices[i];
+    }
+    // cell starts were moved to the ends of cells while sorting
+    for (int c = start.Size - 1; c > 0; --c)
+        start[c] = start[c - 1];
+    start[0] = 0;
+    index.Points.swap(points);
+    index.Indices.swap(indices);
+}
+
+template <typename _Getter>
+void UpdatePointIndex(const Fitter1<_Getter>& fitter, ImPlotPointIndex& index) {
+    ImPlotContext& gp = *GImPlot;
+    const _Getter& getter = fitter.Getter;
+    index.XAxis = gp.CurrentPlot->CurrentX;
+    index.YAxis = gp.CurrentPlot->CurrentY;
+    index.LastFrame = ImGui::GetFrameCount();
+    ImPlotFitKey key_x, key_y;
+    const bool keyed = GetPointIndexKeys(getter, key_x, key_y);
+    if (keyed && getter.Count == index.Count && key_x == index.KeyX && key_y == index.KeyY && gp.NextItemData.AppendedCount == 0)
+        return;
+    index.KeyX  = key_x;
+    index.KeyY  = key_y;
+    index.Count = getter.Count;
+    index.Points.resize(getter.Count);
+    index.Indices.resize(getter.Count);
+    int n = 0;
+    for (int i = 0; i < getter.Count; ++i) {
+        const ImPlotPoint p = getter(i);
+        if (ImNanOrInf(p.x) || ImNanOrInf(p.y))
+            continue;
+        index.Points[n]  = p;
+        index.Indices[n] = i;
+        ++n;
+    }
+    index.Points.shrink(n);
+    index.Indices.shrink(n);
+    SortPointIndex(index);
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Transformers
 //-----------------------------------------------------------------------------
@@ -844,6 +1304,56 @@ struct Transformer2 {
     Transformer1 Ty;
 };
 
+/// Same as Transformer2 for axes without TransformFwd, processing two points per instruction where possible
+IMPLOT_INLINE void TransformLinear(const Transformer2& transformer, const double* xs, const double* ys, int count, ImVec2* out) {
+    const Transformer1& tx = transformer.Tx;
+    const Transformer1& ty = transformer.Ty;
+    int i = 0;
+#if defined(IMPLOT_TRANSFORM_SSE)
+    const __m128d x_plt = _mm_set1_pd(tx.PltMin), x_pix = _mm_set1_pd(tx.PixMin), x_m = _mm_set1_pd(tx.M);
+    const __m128d y_plt = _mm_set1_pd(ty.PltMin), y_pix = _mm_set1_pd(ty.PixMin), y_m = _mm_set1_pd(ty.M);
+    for (; i + 2 <= count; i += 2) {
+        const __m128d x = _mm_add_pd(x_pix, _mm_mul_pd(x_m, _mm_sub_pd(_mm_loadu_pd(xs + i), x_plt)));
+        const __m128d y = _mm_add_pd(y_pix, _mm_mul_pd(y_m, _mm_sub_pd(_mm_loadu_pd(ys + i), y_plt)));
+        _mm_storeu_ps(&out[i].x, _mm_unpacklo_ps(_mm_cvtpd_ps(x), _mm_cvtpd_ps(y)));
+    }
+#elif defined(IMPLOT_TRANSFORM_NEON)
+    const float64x2_t x_plt = vdupq_n_f64(tx.PltMin), x_pix = vdupq_n_f64(tx.PixMin), x_m = vdupq_n_f64(tx.M);
+    const float64x2_t y_plt = vdupq_n_f64(ty.PltMin), y_pix = vdupq_n_f64(ty.PixMin), y_m = vdupq_n_f64(ty.M);
+    for (; i + 2 <= count; i += 2) {
+        float32x2x2_t xy;
+        xy.val[0] = vcvt_f32_f64(vaddq_f64(x_pix, vmulq_f64(x_m, vsubq_f64(vld1q_f64(xs + i), x_plt))));
+        xy.val[1] = vcvt_f32_f64(vaddq_f64(y_pix, vmulq_f64(y_m, vsubq_f64(vld1q_f64(ys + i), y_plt))));
+        vst2_f32(&out[i].x, xy);
+    }
+#endif
+    for (; i < count; ++i) {
+        out[i].x = (float)(tx.PixMin + tx.M * (xs[i] - tx.PltMin));
+        out[i].y = (float)(ty.PixMin + ty.M * (ys[i] - ty.PltMin));
+    }
+}
+
+template <typename _Getter>
+IMPLOT_INLINE void TransformBlock(const _Getter& getter, const Transformer2& transformer, int first, int count, ImVec2* out) {
+    for (int i = 0; i < count; ++i)
+        out[i] = transformer(getter(first + i));
+}
+
+template <typename _IndexerX, typename _IndexerY>
+IMPLOT_INLINE void TransformBlock(const GetterXY<_IndexerX,_IndexerY>& getter, const Transformer2& transformer, int first, int count, ImVec2* out) {
+    double xs[IMPLOT_TRANSFORM_BLOCK_SIZE];
+    double ys[IMPLOT_TRANSFORM_BLOCK_SIZE];
+    IndexBlock(getter.IndxerX, first, count, xs);
+    IndexBlock(getter.IndxerY, first, count, ys);
+    if (transformer.Tx.TransformFwd == nullptr && transformer.Ty.TransformFwd == nullptr) {
+        TransformLinear(transformer, xs, ys, count, out);
+    }
+    else {
+        for (int i = 0; i < count; ++i)
+            out[i] = transformer(xs[i], ys[i]);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // [SECTION] Renderers
 //-----------------------------------------------------------------------------
@@ -852,12 +1362,51 @@ struct RendererBase {
     RendererBase(int prims, int idx_consumed, int vtx_consumed) :
         Prims(prims),
         IdxConsumed(idx_consumed),
-        VtxConsumed(vtx_consumed)
+        VtxConsumed(vtx_consumed),
+        TransformBuffer(GImPlot->TransformBuffer),
+        TransformBlocks(0)
     { }
+    // Restore state that renderers carry between consecutive primitives, so rendering can start at #prim
+    void Seek(int) const { }
+    // Use #buffer (of IMPLOT_TRANSFORM_MAX_BLOCKS blocks) for transformed points of TransformCache members that
+    // didn't claim a block yet, e.g. in a renderer copy of a chunk of parallel rendering
+    void SetTransformBuffer(ImVec2* buffer) const {
+        TransformBuffer = buffer;
+        TransformBlocks = 0;
+    }
+    ImVec2* ClaimTransformBlock() const {
+        IM_ASSERT(TransformBlocks < IMPLOT_TRANSFORM_MAX_BLOCKS);
+        return TransformBuffer + IMPLOT_TRANSFORM_BLOCK_SIZE * TransformBlocks++;
+    }
     const int Prims;
     Transformer2 Transformer;
     const int IdxConsumed;
     const int VtxConsumed;
+    // serial rendering renders one item at a time, so renderers share the buffer of the context by default
+    mutable ImVec2* TransformBuffer;
+    mutable int TransformBlocks;
+};
+
+/// Transforms consecutive getter points to pixel space in blocks, so renderers reading points in order get them
+/// without transforming one at a time. Blocks are stored in the transform buffer of the renderer, which keeps renderers
+/// small to copy; copies start empty and claim blocks of their own buffer.
+struct TransformCache {
+    TransformCache() : Begin(0), End(0), Points(nullptr) { }
+    TransformCache(const TransformCache&) : Begin(0), End(0), Points(nullptr) { }
+    template <typename _Getter>
+    IMPLOT_INLINE ImVec2 operator()(const RendererBase& renderer, const _Getter& getter, int idx) const {
+        if (idx < Begin || idx >= End) {
+            if (Points == nullptr)
+                Points = renderer.ClaimTransformBlock();
+            Begin = idx;
+            End   = ImMin(idx + IMPLOT_TRANSFORM_BLOCK_SIZE, getter.Count);
+            TransformBlock(getter, renderer.Transformer, Begin, End - Begin, Points);
+        }
+        return Points[idx - Begin];
+    }
+    mutable int     Begin;
+    mutable int     End;
+    mutable ImVec2* Points;
 };
 
 template <class _Getter>
@@ -868,13 +1417,16 @@ struct RendererLineStrip : RendererBase {
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(*this, Getter, 0);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
+    void Seek(int prim) const {
+        P1 = Points(*this, Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(*this, Getter, prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -889,6 +1441,7 @@ struct RendererLineStrip : RendererBase {
     mutable ImVec2 P1;
     mutable ImVec2 UV0;
     mutable ImVec2 UV1;
+    TransformCache Points;
 };
 
 template <class _Getter>
@@ -899,13 +1452,19 @@ struct RendererLineStripSkip : RendererBase {
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(*this, Getter, 0);
     }
     void Init(ImDrawList& draw_list) const {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
+    void Seek(int prim) const {
+        // NaN points are skipped, so P1 is the last valid point before #prim (or the first point)
+        P1 = Points(*this, Getter, prim);
+        while (prim > 0 && (ImNan(P1.x) || ImNan(P1.y)))
+            P1 = this->Transformer(Getter(--prim));
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(*this, Getter, prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             if (!ImNan(P2.x) && !ImNan(P2.y))
                 P1 = P2;
@@ -922,6 +1481,7 @@ struct RendererLineStripSkip : RendererBase {
     mutable ImVec2 P1;
     mutable ImVec2 UV0;
     mutable ImVec2 UV1;
+    TransformCache Points;
 };
 
 template <class _Getter>
@@ -936,8 +1496,8 @@ struct RendererLineSegments1 : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P1 = this->Transformer(Getter(prim*2+0));
-        ImVec2 P2 = this->Transformer(Getter(prim*2+1));
+        ImVec2 P1 = Points(*this, Getter, prim*2+0);
+        ImVec2 P2 = Points(*this, Getter, prim*2+1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
             return false;
         PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
@@ -948,6 +1508,7 @@ struct RendererLineSegments1 : RendererBase {
     mutable float HalfWeight;
     mutable ImVec2 UV0;
     mutable ImVec2 UV1;
+    TransformCache Points;
 };
 
 template <class _Getter1, class _Getter2>
@@ -963,8 +1524,8 @@ struct RendererLineSegments2 : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P1 = this->Transformer(Getter1(prim));
-        ImVec2 P2 = this->Transformer(Getter2(prim));
+        ImVec2 P1 = Points1(*this, Getter1, prim);
+        ImVec2 P2 = Points2(*this, Getter2, prim);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2))))
             return false;
         PrimLine(draw_list,P1,P2,HalfWeight,Col,UV0,UV1);
@@ -976,6 +1537,8 @@ struct RendererLineSegments2 : RendererBase {
     mutable float HalfWeight;
     mutable ImVec2 UV0;
     mutable ImVec2 UV1;
+    TransformCache Points1;
+    TransformCache Points2;
 };
 
 template <class _Getter1, class _Getter2>
@@ -1143,13 +1706,16 @@ struct RendererStairsPre : RendererBase {
         Col(col),
         HalfWeight(ImMax(1.0f,weight)*0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(*this, Getter, 0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = Points(*this, Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(*this, Getter, prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -1164,6 +1730,7 @@ struct RendererStairsPre : RendererBase {
     mutable float HalfWeight;
     mutable ImVec2 P1;
     mutable ImVec2 UV;
+    TransformCache Points;
 };
 
 template <class _Getter>
@@ -1174,13 +1741,16 @@ struct RendererStairsPost : RendererBase {
         Col(col),
         HalfWeight(ImMax(1.0f,weight) * 0.5f)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(*this, Getter, 0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = Points(*this, Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(*this, Getter, prim + 1);
         if (!cull_rect.Overlaps(ImRect(ImMin(P1, P2), ImMax(P1, P2)))) {
             P1 = P2;
             return false;
@@ -1195,6 +1765,7 @@ struct RendererStairsPost : RendererBase {
     mutable float HalfWeight;
     mutable ImVec2 P1;
     mutable ImVec2 UV;
+    TransformCache Points;
 };
 
 template <class _Getter>
@@ -1204,14 +1775,17 @@ struct RendererStairsPreShaded : RendererBase {
         Getter(getter),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(*this, Getter, 0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = Points(*this, Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(*this, Getter, prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(Y0, P2.y));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(Y0, P2.y));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1227,6 +1801,7 @@ struct RendererStairsPreShaded : RendererBase {
     float Y0;
     mutable ImVec2 P1;
     mutable ImVec2 UV;
+    TransformCache Points;
 };
 
 template <class _Getter>
@@ -1236,14 +1811,17 @@ struct RendererStairsPostShaded : RendererBase {
         Getter(getter),
         Col(col)
     {
-        P1 = this->Transformer(Getter(0));
+        P1 = Points(*this, Getter, 0);
         Y0 = this->Transformer(ImPlotPoint(0,0)).y;
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P1 = Points(*this, Getter, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P2 = this->Transformer(Getter(prim + 1));
+        ImVec2 P2 = Points(*this, Getter, prim + 1);
         ImVec2 PMin(ImMin(P1.x, P2.x), ImMin(P1.y, Y0));
         ImVec2 PMax(ImMax(P1.x, P2.x), ImMax(P1.y, Y0));
         if (!cull_rect.Overlaps(ImRect(PMin, PMax))) {
@@ -1259,6 +1837,7 @@ struct RendererStairsPostShaded : RendererBase {
     float Y0;
     mutable ImVec2 P1;
     mutable ImVec2 UV;
+    TransformCache Points;
 };
 
 
@@ -1271,15 +1850,19 @@ struct RendererShaded : RendererBase {
         Getter2(getter2),
         Col(col)
     {
-        P11 = this->Transformer(Getter1(0));
-        P12 = this->Transformer(Getter2(0));
+        P11 = Points1(*this, Getter1, 0);
+        P12 = Points2(*this, Getter2, 0);
     }
     void Init(ImDrawList& draw_list) const {
         UV = draw_list._Data->TexUvWhitePixel;
     }
+    void Seek(int prim) const {
+        P11 = Points1(*this, Getter1, prim);
+        P12 = Points2(*this, Getter2, prim);
+    }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 P21 = this->Transformer(Getter1(prim+1));
-        ImVec2 P22 = this->Transformer(Getter2(prim+1));
+        ImVec2 P21 = Points1(*this, Getter1, prim+1);
+        ImVec2 P22 = Points2(*this, Getter2, prim+1);
         ImRect rect(ImMin(ImMin(ImMin(P11,P12),P21),P22), ImMax(ImMax(ImMax(P11,P12),P21),P22));
         if (!cull_rect.Overlaps(rect)) {
             P11 = P21;
@@ -1322,6 +1905,8 @@ struct RendererShaded : RendererBase {
     mutable ImVec2 P11;
     mutable ImVec2 P12;
     mutable ImVec2 UV;
+    TransformCache Points1;
+    TransformCache Points2;
 };
 
 struct RectC {
@@ -1356,13 +1941,93 @@ struct RendererRectC : RendererBase {
 // [SECTION] RenderPrimitives
 //-----------------------------------------------------------------------------
 
-/// Renders primitive shapes in bulk as efficiently as possible.
 template <class _Renderer>
-void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect) {
+struct RenderChunkTask {
+    const _Renderer*   Renderer;
+    const ImRect*      CullRect;
+    ImDrawList*        DrawList;
+    ImPlotRenderChunk* Chunks;
+
+    static void Run(int index, void* data) {
+        const RenderChunkTask& task = *(const RenderChunkTask*)data;
+        ImPlotRenderChunk& chunk = task.Chunks[index];
+        // each chunk needs its own copy of renderer state, starting at its first primitive
+        _Renderer renderer(*task.Renderer);
+        renderer.SetTransformBuffer(chunk.TransformBuffer);
+        renderer.Seek(chunk.PrimBegin);
+        // write to preallocated chunk buffers through a temporary draw list (no allocations in worker threads)
+        ImDrawList writer(task.DrawList->_Data);
+        writer.Flags          = task.DrawList->Flags;
+        writer._VtxWritePtr   = chunk.VtxBuffer.Data;
+        writer._IdxWritePtr   = chunk.IdxBuffer.Data;
+        writer._VtxCurrentIdx = 0;
+        int rendered = 0;
+        for (int prim = chunk.PrimBegin; prim != chunk.PrimEnd; ++prim) {
+            if (renderer.Render(writer, *task.CullRect, prim))
+                rendered++;
+        }
+        chunk.PrimsRendered = rendered;
+    }
+};
+
+/// Renders chunks of primitives in parallel and splices them into the draw list in order. Returns false if primitives
+/// should be rendered serially. Requires that renderer was initialized.
+template <class _Renderer>
+bool RenderPrimitivesParallel(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect) {
+    ImPlotContext& gp = *GImPlot;
+    const int chunks_count = ImMin(renderer.Prims / IMPLOT_RENDER_CHUNK_MIN_PRIMS, IMPLOT_RENDER_MAX_CHUNKS);
+    if (gp.ParallelForCallback == nullptr || chunks_count < 2)
+        return false;
+    ImPlotRenderChunk* chunks = gp.RenderChunks;
+    for (int i = 0; i < chunks_count; ++i) {
+        ImPlotRenderChunk& chunk = chunks[i];
+        chunk.PrimBegin = (int)((ImS64)renderer.Prims * i / chunks_count);
+        chunk.PrimEnd   = (int)((ImS64)renderer.Prims * (i + 1) / chunks_count);
+        chunk.VtxBuffer.resize((chunk.PrimEnd - chunk.PrimBegin) * renderer.VtxConsumed);
+        chunk.IdxBuffer.resize((chunk.PrimEnd - chunk.PrimBegin) * renderer.IdxConsumed);
+    }
+    RenderChunkTask<_Renderer> task = { &renderer, &cull_rect, &draw_list, chunks };
+    gp.ParallelForCallback(chunks_count, &RenderChunkTask<_Renderer>::Run, &task, gp.ParallelForCallbackData);
+    // splice rendered primitives (culled ones left no output in chunk buffers)
+    int prims_rendered = 0;
+    for (int i = 0; i < chunks_count; ++i)
+        prims_rendered += chunks[i].PrimsRendered;
+    if (prims_rendered == 0)
+        return true;
+    for (int i = 0; i < chunks_count; ++i) {
+        const ImPlotRenderChunk& chunk = chunks[i];
+        // splice in segments that fit below MaxIdx, like serial rendering PrimReserve starts a new draw command when
+        // the current one runs out of indices
+        unsigned int spliced = 0;
+        while (spliced < (unsigned int)chunk.PrimsRendered) {
+            unsigned int cnt = (MaxIdx<ImDrawIdx>::Value - draw_list._VtxCurrentIdx) / renderer.VtxConsumed;
+            if (cnt == 0)
+                cnt = MaxIdx<ImDrawIdx>::Value / renderer.VtxConsumed;
+            cnt = ImMin(cnt, (unsigned int)chunk.PrimsRendered - spliced);
+            const int vtx_count = cnt * renderer.VtxConsumed;
+            const int idx_count = cnt * renderer.IdxConsumed;
+            draw_list.PrimReserve(idx_count, vtx_count);
+            memcpy(draw_list._VtxWritePtr, chunk.VtxBuffer.Data + spliced * renderer.VtxConsumed, vtx_count * sizeof(ImDrawVert));
+            // chunk indices start at 0 for the chunk, so rebase them to the segment and then to the draw list
+            const ImDrawIdx* src = chunk.IdxBuffer.Data + spliced * renderer.IdxConsumed;
+            const ImDrawIdx base = (ImDrawIdx)(draw_list._VtxCurrentIdx - spliced * renderer.VtxConsumed);
+            for (int j = 0; j < idx_count; ++j)
+                draw_list._IdxWritePtr[j] = (ImDrawIdx)(src[j] + base);
+            draw_list._VtxWritePtr   += vtx_count;
+            draw_list._IdxWritePtr   += idx_count;
+            draw_list._VtxCurrentIdx += vtx_count;
+            spliced += cnt;
+        }
+    }
+    return true;
+}
+
+/// Renders primitives one by one, reserving draw list space in blocks. Requires that renderer was initialized.
+template <class _Renderer>
+void RenderPrimitivesSerial(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect) {
     unsigned int prims        = renderer.Prims;
     unsigned int prims_culled = 0;
     unsigned int idx          = 0;
-    renderer.Init(draw_list);
     while (prims) {
         // find how many can be reserved up to end of current draw command's limit
         unsigned int cnt = ImMin(prims, (MaxIdx<ImDrawIdx>::Value - draw_list._VtxCurrentIdx) / renderer.VtxConsumed);
@@ -1396,18 +2061,74 @@ void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const
         draw_list.PrimUnreserve(prims_culled * renderer.IdxConsumed, prims_culled * renderer.VtxConsumed);
 }
 
+#ifdef IMPLOT_DEBUG_PARALLEL_RENDER
+/// Appends indices of #draw_list from #idx_begin to #out, resolved to positions in its vertex buffer relative to
+/// #vtx_begin, so outputs split into draw commands at different points can be compared.
+static void ResolveIndices(const ImDrawList& draw_list, int vtx_begin, int idx_begin, ImVector<unsigned int>& out) {
+    for (const ImDrawCmd& cmd : draw_list.CmdBuffer) {
+        const int idx_end = (int)(cmd.IdxOffset + cmd.ElemCount);
+        for (int i = ImMax((int)cmd.IdxOffset, idx_begin); i < idx_end; ++i)
+            out.push_back(cmd.VtxOffset + draw_list.IdxBuffer.Data[i] - vtx_begin);
+    }
+}
+
+/// Renders primitives serially into a temporary draw list and asserts that the output is identical to the output of
+/// parallel rendering, which was appended to the draw list at #vtx_begin and #idx_begin. Renderer must be initialized
+/// and in its initial state (chunks render with its copies).
+template <class _Renderer>
+void CheckParallelRender(const _Renderer& renderer, const ImDrawList& draw_list, const ImRect& cull_rect, int vtx_begin, int idx_begin) {
+    ImDrawList serial(draw_list._Data);
+    serial._ResetForNewFrame();
+    serial.Flags = draw_list.Flags;
+    RenderPrimitivesSerial(renderer, serial, cull_rect);
+    const int vtx_count = draw_list.VtxBuffer.Size - vtx_begin;
+    bool same = serial.VtxBuffer.Size == vtx_count && serial.IdxBuffer.Size == draw_list.IdxBuffer.Size - idx_begin;
+    if (same)
+        same = ImHashData(serial.VtxBuffer.Data, vtx_count * sizeof(ImDrawVert)) == ImHashData(draw_list.VtxBuffer.Data + vtx_begin, vtx_count * sizeof(ImDrawVert));
+    if (same) {
+        ImVector<unsigned int> serial_indices, parallel_indices;
+        ResolveIndices(serial, 0, 0, serial_indices);
+        ResolveIndices(draw_list, vtx_begin, idx_begin, parallel_indices);
+        same = serial_indices.Size == parallel_indices.Size && memcmp(serial_indices.Data, parallel_indices.Data, serial_indices.size_in_bytes()) == 0;
+    }
+    IM_ASSERT(same && "Parallel rendering output differs from serial rendering!");
+}
+#endif
+
+/// Renders primitive shapes in bulk as efficiently as possible. Primitives are rendered in parallel only if #concurrent
+/// is set (getters can be evaluated concurrently) and axes have no user transform callbacks.
+template <class _Renderer>
+void RenderPrimitivesEx(const _Renderer& renderer, ImDrawList& draw_list, const ImRect& cull_rect, bool concurrent = false) {
+    renderer.Init(draw_list);
+    // transforms of custom axis scales are user callbacks, which are not assumed to be thread-safe
+    concurrent = concurrent && renderer.Transformer.Tx.TransformFwd == nullptr && renderer.Transformer.Ty.TransformFwd == nullptr;
+#ifdef IMPLOT_DEBUG_PARALLEL_RENDER
+    const int vtx_begin = draw_list.VtxBuffer.Size;
+    const int idx_begin = draw_list.IdxBuffer.Size;
+    if (concurrent && RenderPrimitivesParallel(renderer, draw_list, cull_rect)) {
+        CheckParallelRender(renderer, draw_list, cull_rect, vtx_begin, idx_begin);
+        return;
+    }
+#else
+    if (concurrent && RenderPrimitivesParallel(renderer, draw_list, cull_rect))
+        return;
+#endif
+    RenderPrimitivesSerial(renderer, draw_list, cull_rect);
+}
+
 template <template <class> class _Renderer, class _Getter, typename ...Args>
 void RenderPrimitives1(const _Getter& getter, Args... args) {
     ImDrawList& draw_list = *GetPlotDrawList();
     const ImRect& cull_rect = GetCurrentPlot()->PlotRect;
-    RenderPrimitivesEx(_Renderer<_Getter>(getter,args...), draw_list, cull_rect);
+    RenderPrimitivesEx(_Renderer<_Getter>(getter,args...), draw_list, cull_rect, IsConcurrentGetter<_Getter>::Value);
 }
 
 template <template <class,class> class _Renderer, class _Getter1, class _Getter2, typename ...Args>
 void RenderPrimitives2(const _Getter1& getter1, const _Getter2& getter2, Args... args) {
     ImDrawList& draw_list = *GetPlotDrawList();
     const ImRect& cull_rect = GetCurrentPlot()->PlotRect;
-    RenderPrimitivesEx(_Renderer<_Getter1,_Getter2>(getter1,getter2,args...), draw_list, cull_rect);
+    RenderPrimitivesEx(_Renderer<_Getter1,_Getter2>(getter1,getter2,args...), draw_list, cull_rect,
+                       IsConcurrentGetter<_Getter1>::Value && IsConcurrentGetter<_Getter2>::Value);
 }
 
 //-----------------------------------------------------------------------------
@@ -1428,7 +2149,7 @@ struct RendererMarkersFill : RendererBase {
         UV = draw_list._Data->TexUvWhitePixel;
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
+        ImVec2 p = Points(*this, Getter, prim);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             for (int i = 0; i < Count; i++) {
                 draw_list._VtxWritePtr[0].pos.x = p.x + Marker[i].x * Size;
@@ -1454,6 +2175,7 @@ struct RendererMarkersFill : RendererBase {
     const float Size;
     const ImU32 Col;
     mutable ImVec2 UV;
+    TransformCache Points;
 };
 
 
@@ -1472,7 +2194,7 @@ struct RendererMarkersLine : RendererBase {
         GetLineRenderProps(draw_list, HalfWeight, UV0, UV1);
     }
     IMPLOT_INLINE bool Render(ImDrawList& draw_list, const ImRect& cull_rect, int prim) const {
-        ImVec2 p = this->Transformer(Getter(prim));
+        ImVec2 p = Points(*this, Getter, prim);
         if (p.x >= cull_rect.Min.x && p.y >= cull_rect.Min.y && p.x <= cull_rect.Max.x && p.y <= cull_rect.Max.y) {
             for (int i = 0; i < Count; i = i + 2) {
                 ImVec2 p1(p.x + Marker[i].x * Size, p.y + Marker[i].y * Size);
@@ -1491,6 +2213,7 @@ struct RendererMarkersLine : RendererBase {
     const ImU32 Col;
     mutable ImVec2 UV0;
     mutable ImVec2 UV1;
+    TransformCache Points;
 };
 
 static const ImVec2 MARKER_FILL_CIRCLE[10]  = {ImVec2(1.0f, 0.0f), ImVec2(0.809017f, 0.58778524f),ImVec2(0.30901697f, 0.95105654f),ImVec2(-0.30901703f, 0.9510565f),ImVec2(-0.80901706f, 0.5877852f),ImVec2(-1.0f, 0.0f),ImVec2(-0.80901694f, -0.58778536f),ImVec2(-0.3090171f, -0.9510565f),ImVec2(0.30901712f, -0.9510565f),ImVec2(0.80901694f, -0.5877853f)};
@@ -1563,52 +2286,417 @@ void RenderMarkers(const _Getter& getter, ImPlotMarker marker, float size, bool
 }
 
 //-----------------------------------------------------------------------------
-// [SECTION] PlotLine
+// [SECTION] Decimation
 //-----------------------------------------------------------------------------
 
+// Decimation is only worth it when there are noticeably more samples than pixels.
+static const int DECIMATE_MIN_SAMPLES_PER_PIXEL = 4;
+// Series with at least this number of samples are decimated with retained level-of-detail pyramids.
+static const int DECIMATE_LOD_MIN_SAMPLES = 1 << 16;
+
+// Finds range [first,last) of samples that can affect the current x range, including one sample on each side of
+// it, so lines entering and leaving the plot are kept. Requires increasing x values.
 template <typename _Getter>
-void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
-    if (BeginItemEx(label_id, Fitter1<_Getter>(getter), flags, ImPlotCol_Line)) {
-        if (getter.Count <= 0) {
-            EndItem();
+void FindVisibleRange(const _Getter& getter, const ImPlotAxis& x_axis, int& first, int& last) {
+    const double x_min = x_axis.Range.Min;
+    const double x_max = x_axis.Range.Max;
+    int lo = 0, hi = getter.Count;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        if (getter(mid).x < x_min) lo = mid + 1; else hi = mid;
+    }
+    first = ImMax(lo - 1, 0);
+    hi = getter.Count;
+    while (lo < hi) {
+        const int mid = lo + (hi - lo) / 2;
+        if (getter(mid).x <= x_max) lo = mid + 1; else hi = mid;
+    }
+    last = ImMin(lo + 1, getter.Count);
+}
+
+// Returns pixel column of x value, clamped so points far outside of the plot don't overflow.
+IMPLOT_INLINE int PixelColumn(const Transformer1& tx, double x) {
+    return (int)ImFloor(ImClamp(tx(x), -1.0e9f, 1.0e9f));
+}
+
+// Adds indices of the first, min, max and last samples of a run in increasing order, skipping duplicates and
+// missing (-1) extremes.
+IMPLOT_INLINE void PushRun(int first, int min, int max, int last, ImVector<int>& out) {
+    int idx[4] = { first, min, max, last };
+    if (idx[1] > idx[2])
+        ImSwap(idx[1], idx[2]);
+    int prev = -1;
+    for (int i = 0; i < 4; ++i) {
+        if (idx[i] > prev) {
+            out.push_back(idx[i]);
+            prev = idx[i];
+        }
+    }
+}
+
+// Min/max-per-pixel decimation (M4): consecutive samples that fall to the same pixel column are replaced with the
+// first, minimum, maximum and last of them (in original order). Rendered line covers exactly the same pixels as the
+// full one. NaN values break runs and are kept, so ImPlotLineFlags_SkipNaN behaves as without decimation.
+template <typename _Getter>
+void DecimateMinMax(const _Getter& getter, const Transformer1& tx, int first, int last, ImVector<int>& out) {
+    int col = 0, run_first = -1, run_last = 0, run_min = 0, run_max = 0;
+    double y_min = 0, y_max = 0;
+    auto flush = [&]() {
+        if (run_first < 0)
             return;
+        PushRun(run_first, run_min, run_max, run_last, out);
+        run_first = -1;
+    };
+    for (int i = first; i < last; ++i) {
+        const ImPlotPoint p = getter(i);
+        if (ImNan(p.y)) {
+            flush();
+            out.push_back(i);
+            continue;
         }
-        const ImPlotNextItemData& s = GetItemData();
-        if (getter.Count > 1) {
-            if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
-                const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
-                GetterOverrideY<_Getter> getter2(getter, 0);
-                RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
+        const int c = PixelColumn(tx, p.x);
+        if (run_first < 0 || c != col) {
+            flush();
+            col = c;
+            run_first = run_last = run_min = run_max = i;
+            y_min = y_max = p.y;
+        }
+        else {
+            run_last = i;
+            if (p.y < y_min) { y_min = p.y; run_min = i; }
+            if (p.y > y_max) { y_max = p.y; run_max = i; }
+        }
+    }
+    flush();
+}
+
+// Largest-Triangle-Three-Buckets decimation to the given number of samples. Areas are computed in pixel space, so the
+// result follows axis scales.
+template <typename _Getter>
+void DecimateLTTB(const _Getter& getter, const Transformer2& transformer, int first, int last, int threshold, ImVector<int>& out) {
+    const int count = last - first;
+    if (count <= threshold || threshold < 3) {
+        for (int i = first; i < last; ++i)
+            out.push_back(i);
+        return;
+    }
+    const double bucket = (double)(count - 2) / (threshold - 2);
+    int a = first;
+    ImVec2 pa = transformer(getter(a));
+    out.push_back(a);
+    for (int b = 0; b < threshold - 2; ++b) {
+        // average of the next bucket (or the last sample for the last bucket)
+        const int next_begin = first + 1 + (int)((b + 1) * bucket);
+        const int next_end   = ImMin(first + 1 + (int)((b + 2) * bucket), last);
+        ImVec2 avg(0, 0);
+        int avg_count = 0;
+        for (int i = next_begin; i < next_end; ++i) {
+            const ImVec2 p = transformer(getter(i));
+            if (!ImNan(p.y)) {
+                avg += p;
+                avg_count++;
             }
-            if (s.RenderLine) {
-                const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
-                if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
-                    RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
-                }
-                else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
-                }
-                else {
-                    if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
-                        RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
-                    else
-                        RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
-                }
+        }
+        avg = avg_count > 0 ? avg / (float)avg_count : transformer(getter(last - 1));
+        // point of the current bucket forming the largest triangle with the previous pick and the average
+        const int cur_begin = first + 1 + (int)(b * bucket);
+        const int cur_end   = ImMin(next_begin, last - 1);
+        int pick = cur_begin;
+        float max_area = -1;
+        for (int i = cur_begin; i < cur_end; ++i) {
+            const ImVec2 p = transformer(getter(i));
+            const float area = ImAbs((pa.x - avg.x) * (p.y - pa.y) - (pa.x - p.x) * (avg.y - pa.y));
+            if (area > max_area) {
+                max_area = area;
+                pick = i;
             }
         }
-        // render markers
-        if (s.Marker != ImPlotMarker_None) {
-            if (ImHasFlag(flags, ImPlotLineFlags_NoClip)) {
-                PopPlotClipRect();
-                PushPlotClipRect(s.MarkerSize);
+        a = pick;
+        pa = transformer(getter(a));
+        out.push_back(a);
+    }
+    out.push_back(last - 1);
+}
+
+// Identifies data of array based getters by their pointer and stride, so their level-of-detail pyramids can be retained
+// between frames. Returns null for getters which cannot be retained (user callbacks, or offsets for which appending
+// would shift samples).
+template <typename _Getter>
+const void* GetLodDataKey(const _Getter&, int&) { return nullptr; }
+
+template <typename T>
+const void* GetLodDataKey(const GetterXY<IndexerLin,IndexerIdx<T>>& getter, int& stride) {
+    stride = getter.IndxerY.Stride;
+    return getter.IndxerY.Offset == 0 ? getter.IndxerY.Data : nullptr;
+}
+
+template <typename T>
+const void* GetLodDataKey(const GetterXY<IndexerIdx<T>,IndexerIdx<T>>& getter, int& stride) {
+    stride = getter.IndxerY.Stride;
+    return getter.IndxerY.Offset == 0 ? getter.IndxerY.Data : nullptr;
+}
+
+// Returns the index of the smaller (or larger) sample, ignoring missing (-1) indices.
+template <typename _Getter>
+IMPLOT_INLINE int LodPick(const _Getter& getter, int a, int b, bool larger) {
+    if (a < 0 || b < 0)
+        return a < 0 ? b : a;
+    const double ya = getter(a).y;
+    const double yb = getter(b).y;
+    return (larger ? yb > ya : yb < ya) ? b : a;
+}
+
+// Updates extremes with samples in range [first,last). NaNs are not extremes, but they are recorded in the bucket.
+template <typename _Getter>
+IMPLOT_INLINE void LodScan(const _Getter& getter, int first, int last, ImPlotLodBucket& bucket) {
+    double y_min = bucket.Min >= 0 ? getter(bucket.Min).y : HUGE_VAL;
+    double y_max = bucket.Max >= 0 ? getter(bucket.Max).y : -HUGE_VAL;
+    for (int i = first; i < last; ++i) {
+        const double y = getter(i).y;
+        if (y < y_min) { y_min = y; bucket.Min = i; }
+        if (y > y_max) { y_max = y; bucket.Max = i; }
+        bucket.HasNaN |= ImNan(y);
+    }
+}
+
+// Adds buckets for samples appended since the last update.
+template <typename _Getter>
+void UpdateLineLod(const _Getter& getter, ImPlotLineLod& lod) {
+    ImVector<ImPlotLodBucket>& level0 = lod.Levels[0];
+    const int count0 = getter.Count / IMPLOT_LOD_BUCKET_SIZE;
+    level0.reserve(count0);
+    for (int b = level0.Size; b < count0; ++b) {
+        ImPlotLodBucket bucket = { -1, -1, false };
+        LodScan(getter, b * IMPLOT_LOD_BUCKET_SIZE, (b + 1) * IMPLOT_LOD_BUCKET_SIZE, bucket);
+        level0.push_back(bucket);
+    }
+    for (int l = 1; l < IMPLOT_LOD_MAX_LEVELS; ++l) {
+        const ImVector<ImPlotLodBucket>& src = lod.Levels[l-1];
+        ImVector<ImPlotLodBucket>& dst = lod.Levels[l];
+        const int count = src.Size / 2;
+        dst.reserve(count);
+        for (int b = dst.Size; b < count; ++b) {
+            const ImPlotLodBucket& a = src[2*b];
+            const ImPlotLodBucket& c = src[2*b+1];
+            ImPlotLodBucket bucket = { LodPick(getter, a.Min, c.Min, false), LodPick(getter, a.Max, c.Max, true), a.HasNaN || c.HasNaN };
+            dst.push_back(bucket);
+        }
+    }
+    lod.Count = getter.Count;
+    lod.LastY = getter(getter.Count - 1).y;
+}
+
+// Returns the level-of-detail pyramid of the current item, updated to match the getter. Samples that are already in
+// the pyramid are assumed to not change (only the last one is checked, which is why it requires
+// ImPlotLineFlags_DecimateRetained), so it is rebuilt only when the data pointer or stride changes, the series shrinks
+// or the last known sample is modified. Returns null if getter data cannot be retained.
+template <typename _Getter>
+ImPlotLineLod* GetLineLod(const _Getter& getter) {
+    int stride = 0;
+    const void* data = GetLodDataKey(getter, stride);
+    if (data == nullptr)
+        return nullptr;
+    ImPlotContext& gp = *GImPlot;
+    const int frame = ImGui::GetFrameCount();
+    if (gp.LineLodSweepFrame != frame) {
+        gp.LineLodSweepFrame = frame;
+        for (int n = 0; n < gp.LineLods.GetMapSize(); ++n) {
+            ImPlotLineLod* stale = gp.LineLods.TryGetMapData(n);
+            if (stale && frame - stale->LastFrame > IMPLOT_LOD_RELEASE_FRAMES)
+                gp.LineLods.Remove(gp.LineLods.Map.Data[n].key, stale);
+        }
+    }
+    ImPlotLineLod& lod = *gp.LineLods.GetOrAddByKey(GetCurrentItem()->ID);
+    lod.LastFrame = frame;
+    bool valid = lod.Data == data && lod.Stride == stride && lod.Count <= getter.Count;
+    if (valid && lod.Count > 0) {
+        const double y = getter(lod.Count - 1).y;
+        valid = y == lod.LastY || (ImNan(y) && ImNan(lod.LastY));
+    }
+    if (!valid) {
+        for (int l = 0; l < IMPLOT_LOD_MAX_LEVELS; ++l)
+            lod.Levels[l].resize(0);
+        lod.Data   = data;
+        lod.Stride = stride;
+        lod.Count  = 0;
+    }
+    if (lod.Count != getter.Count)
+        UpdateLineLod(getter, lod);
+    return &lod;
+}
+
+// Finds extreme samples in range [first,last), reading full buckets from the pyramid and remaining samples directly.
+template <typename _Getter>
+void QueryLineLod(const _Getter& getter, const ImPlotLineLod& lod, int first, int last, ImPlotLodBucket& out) {
+    out.Min = out.Max = -1;
+    out.HasNaN = false;
+    int b_first = (first + IMPLOT_LOD_BUCKET_SIZE - 1) / IMPLOT_LOD_BUCKET_SIZE;
+    int b_last  = ImMin(last / IMPLOT_LOD_BUCKET_SIZE, lod.Levels[0].Size);
+    if (b_first >= b_last) {
+        LodScan(getter, first, last, out);
+        return;
+    }
+    LodScan(getter, first, b_first * IMPLOT_LOD_BUCKET_SIZE, out);
+    LodScan(getter, b_last * IMPLOT_LOD_BUCKET_SIZE, last, out);
+    // take at most two buckets per level, moving to the coarser level with the remaining aligned range
+    auto take = [&](const ImPlotLodBucket& bucket) {
+        out.Min = LodPick(getter, out.Min, bucket.Min, false);
+        out.Max = LodPick(getter, out.Max, bucket.Max, true);
+        out.HasNaN |= bucket.HasNaN;
+    };
+    for (int l = 0; b_first < b_last; ++l) {
+        const ImVector<ImPlotLodBucket>& level = lod.Levels[l];
+        if (l == IMPLOT_LOD_MAX_LEVELS - 1) {
+            for (int b = b_first; b < b_last; ++b)
+                take(level[b]);
+            break;
+        }
+        if (b_first & 1)
+            take(level[b_first++]);
+        if (b_last & 1)
+            take(level[--b_last]);
+        b_first >>= 1;
+        b_last  >>= 1;
+    }
+}
+
+// Min/max-per-pixel decimation (M4) using a level-of-detail pyramid. Pixel columns are found with binary search, so
+// the cost depends on the number of pixels and only logarithmically on the number of samples. Requires increasing x
+// values. Unless #skip_nan is set, columns with NaNs are decimated directly, so NaNs break the line as in
+// DecimateMinMax.
+template <typename _Getter>
+void DecimateMinMaxLod(const _Getter& getter, const ImPlotLineLod& lod, const Transformer1& tx, int first, int last, bool skip_nan, ImVector<int>& out) {
+    int i = first;
+    while (i < last) {
+        const int col = PixelColumn(tx, getter(i).x);
+        int lo = i + 1, hi = last;
+        while (lo < hi) {
+            const int mid = lo + (hi - lo) / 2;
+            if (PixelColumn(tx, getter(mid).x) == col) lo = mid + 1; else hi = mid;
+        }
+        ImPlotLodBucket extremes;
+        QueryLineLod(getter, lod, i, lo, extremes);
+        if (extremes.HasNaN && !skip_nan)
+            DecimateMinMax(getter, tx, i, lo, out);
+        else
+            PushRun(i, extremes.Min, extremes.Max, lo - 1, out);
+        i = lo;
+    }
+}
+
+// Fills indices of line samples to render. Returns false if decimation would not reduce the number of samples.
+template <typename _Getter>
+bool DecimateLine(const _Getter& getter, ImPlotLineFlags flags, ImVector<int>& out) {
+    ImPlotPlot& plot = *GetCurrentPlot();
+    const ImPlotAxis& x_axis = plot.Axes[plot.CurrentX];
+    const int width = (int)x_axis.PixelSize() + 1;
+    if (getter.Count <= width * DECIMATE_MIN_SAMPLES_PER_PIXEL)
+        return false;
+    int first, last;
+    FindVisibleRange(getter, x_axis, first, last);
+    out.resize(0);
+    const Transformer2 transformer(plot);
+    if (ImHasFlag(flags, ImPlotLineFlags_DecimateRetained)) {
+        // small series are cheaper to decimate directly than to keep in a pyramid
+        const ImPlotLineLod* lod = getter.Count >= DECIMATE_LOD_MIN_SAMPLES ? GetLineLod(getter) : nullptr;
+        if (lod != nullptr)
+            DecimateMinMaxLod(getter, *lod, transformer.Tx, first, last, ImHasFlag(flags, ImPlotLineFlags_SkipNaN), out);
+        else
+            DecimateMinMax(getter, transformer.Tx, first, last, out);
+    }
+    else if (ImHasFlag(flags, ImPlotLineFlags_Decimate))
+        DecimateMinMax(getter, transformer.Tx, first, last, out);
+    else
+        DecimateLTTB(getter, transformer, first, last, 2 * width, out);
+    return true;
+}
+
+// Fills indices of scatter points to render, keeping only the first point that falls to each pixel. Returns false if
+// decimation would not reduce the number of points.
+template <typename _Getter>
+bool DecimateScatter(const _Getter& getter, float marker_size, ImVector<int>& out) {
+    ImPlotContext& gp = *GImPlot;
+    ImPlotPlot& plot = *GetCurrentPlot();
+    ImRect rect = plot.PlotRect;
+    rect.Expand(ImCeil(marker_size));
+    const int width = (int)rect.GetWidth() + 1;
+    const int height = (int)rect.GetHeight() + 1;
+    if (getter.Count <= width * DECIMATE_MIN_SAMPLES_PER_PIXEL)
+        return false;
+    gp.DecimationGrid.Create(width * height);
+    out.resize(0);
+    const Transformer2 transformer(plot);
+    for (int i = 0; i < getter.Count; ++i) {
+        const ImVec2 p = transformer(getter(i)) - rect.Min;
+        if (p.x >= 0 && p.y >= 0 && p.x < width && p.y < height) {
+            const int cell = (int)p.y * width + (int)p.x;
+            if (!gp.DecimationGrid.TestBit(cell)) {
+                gp.DecimationGrid.SetBit(cell);
+                out.push_back(i);
             }
-            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
-            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
         }
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// [SECTION] PlotLine
+//-----------------------------------------------------------------------------
+
+template <typename _Getter>
+void RenderLineItem(const _Getter& getter, ImPlotLineFlags flags) {
+    const ImPlotNextItemData& s = GetItemData();
+    if (getter.Count > 1) {
+        if (ImHasFlag(flags, ImPlotLineFlags_Shaded) && s.RenderFill) {
+            const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_Fill]);
+            GetterOverrideY<_Getter> getter2(getter, 0);
+            RenderPrimitives2<RendererShaded>(getter,getter2,col_fill);
+        }
+        if (s.RenderLine) {
+            const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_Line]);
+            if (ImHasFlag(flags,ImPlotLineFlags_Segments)) {
+                RenderPrimitives1<RendererLineSegments1>(getter,col_line,s.LineWeight);
+            }
+            else if (ImHasFlag(flags, ImPlotLineFlags_Loop)) {
+                if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                    RenderPrimitives1<RendererLineStripSkip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+                else
+                    RenderPrimitives1<RendererLineStrip>(GetterLoop<_Getter>(getter),col_line,s.LineWeight);
+            }
+            else {
+                if (ImHasFlag(flags, ImPlotLineFlags_SkipNaN))
+                    RenderPrimitives1<RendererLineStripSkip>(getter,col_line,s.LineWeight);
+                else
+                    RenderPrimitives1<RendererLineStrip>(getter,col_line,s.LineWeight);
+            }
+        }
+    }
+    // render markers
+    if (s.Marker != ImPlotMarker_None) {
+        if (ImHasFlag(flags, ImPlotLineFlags_NoClip)) {
+            PopPlotClipRect();
+            PushPlotClipRect(s.MarkerSize);
+        }
+        const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
+        const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
+        RenderMarkers<_Getter>(getter, s.Marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+    }
+}
+
+template <typename _Getter>
+void PlotLineEx(const char* label_id, const _Getter& getter, ImPlotLineFlags flags) {
+    if (BeginItemEx(label_id, Fitter1<_Getter>(getter), flags, ImPlotCol_Line)) {
+        if (getter.Count <= 0) {
+            EndItem();
+            return;
+        }
+        ImVector<int>& indices = GImPlot->DecimatedIndices;
+        const bool decimate = (flags & (ImPlotLineFlags_Decimate | ImPlotLineFlags_DecimateLTTB | ImPlotLineFlags_DecimateRetained)) != 0
+                           && (flags & (ImPlotLineFlags_Segments | ImPlotLineFlags_Loop)) == 0;
+        if (decimate && DecimateLine(getter, flags, indices))
+            RenderLineItem(GetterIndexed<_Getter>(getter, indices.Data, indices.Size), flags);
+        else
+            RenderLineItem(getter, flags);
         EndItem();
     }
 }
@@ -1625,9 +2713,16 @@ void PlotLine(const char* label_id, const T* xs, const T* ys, int count, ImPlotL
     PlotLineEx(label_id, getter, flags);
 }
 
+template <typename T>
+void PlotLineRing(const char* label_id, const T* xs, const T* ys, int count, int capacity, int head, ImPlotLineFlags flags, int stride) {
+    GetterXY<IndexerRing<T>,IndexerRing<T>> getter(IndexerRing<T>(xs,capacity,head,stride),IndexerRing<T>(ys,capacity,head,stride),ImMin(count,capacity));
+    PlotLineEx(label_id, getter, flags);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotLine<T> (const char* label_id, const T* values, int count, double xscale, double x0, ImPlotLineFlags flags, int offset, int stride); \
-    template IMPLOT_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotLineFlags flags, int offset, int stride);
+    template IMPLOT_API void PlotLine<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotLineFlags flags, int offset, int stride); \
+    template IMPLOT_API void PlotLineRing<T>(const char* label_id, const T* xs, const T* ys, int count, int capacity, int head, ImPlotLineFlags flags, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -1657,7 +2752,11 @@ void PlotScatterEx(const char* label_id, const Getter& getter, ImPlotScatterFlag
             }
             const ImU32 col_line = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerOutline]);
             const ImU32 col_fill = ImGui::GetColorU32(s.Colors[ImPlotCol_MarkerFill]);
-            RenderMarkers<Getter>(getter, marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+            ImVector<int>& indices = GImPlot->DecimatedIndices;
+            if (ImHasFlag(flags, ImPlotScatterFlags_Decimate) && DecimateScatter(getter, s.MarkerSize, indices))
+                RenderMarkers<GetterIndexed<Getter>>(GetterIndexed<Getter>(getter, indices.Data, indices.Size), marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
+            else
+                RenderMarkers<Getter>(getter, marker, s.MarkerSize, s.RenderMarkerFill, col_fill, s.RenderMarkerLine, col_line, s.MarkerWeight);
         }
         EndItem();
     }
@@ -1675,9 +2774,16 @@ void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, ImPl
     return PlotScatterEx(label_id, getter, flags);
 }
 
+template <typename T>
+void PlotScatterRing(const char* label_id, const T* xs, const T* ys, int count, int capacity, int head, ImPlotScatterFlags flags, int stride) {
+    GetterXY<IndexerRing<T>,IndexerRing<T>> getter(IndexerRing<T>(xs,capacity,head,stride),IndexerRing<T>(ys,capacity,head,stride),ImMin(count,capacity));
+    PlotScatterEx(label_id, getter, flags);
+}
+
 #define INSTANTIATE_MACRO(T) \
     template IMPLOT_API void PlotScatter<T>(const char* label_id, const T* values, int count, double xscale, double x0, ImPlotScatterFlags flags, int offset, int stride); \
-    template IMPLOT_API void PlotScatter<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotScatterFlags flags, int offset, int stride);
+    template IMPLOT_API void PlotScatter<T>(const char* label_id, const T* xs, const T* ys, int count, ImPlotScatterFlags flags, int offset, int stride); \
+    template IMPLOT_API void PlotScatterRing<T>(const char* label_id, const T* xs, const T* ys, int count, int capacity, int head, ImPlotScatterFlags flags, int stride);
 CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 #undef INSTANTIATE_MACRO
 
@@ -1924,9 +3030,7 @@ void PlotBarGroups(const char* const label_ids[], const T* values, int item_coun
     const bool stack = ImHasFlag(flags, ImPlotBarGroupsFlags_Stacked);
     if (stack) {
         SetupLock();
-        ImPlotContext& gp = *GImPlot;
-        gp.TempDouble1.resize(4*group_count);
-        double* temp = gp.TempDouble1.Data;
+        double* temp = GImGui->FrameArena.AllocArray<double>(4*group_count);
         double* neg =      &temp[0];
         double* pos =      &temp[group_count];
         double* curr_min = &temp[group_count*2];
@@ -2408,6 +3512,84 @@ struct GetterHeatmapColMaj {
     const ImPlotPoint HalfSize;
 };
 
+// Fast non-cryptographic hash, used to detect changes of large data blocks.
+static ImU64 HashData64(const void* data, size_t size, ImU64 seed) {
+    const unsigned char* bytes = (const unsigned char*)data;
+    ImU64 h = seed ^ (size * 0x9E3779B97F4A7C15ull);
+    for (; size >= 8; size -= 8, bytes += 8) {
+        ImU64 w;
+        memcpy(&w, bytes, 8);
+        h = (h ^ w) * 0xFF51AFD7ED558CCDull;
+        h ^= h >> 32;
+    }
+    for (; size > 0; --size, ++bytes)
+        h = (h ^ *bytes) * 0x100000001B3ull;
+    return h;
+}
+
+// Number of values colormapped in one block.
+static const int HEATMAP_BLOCK_SIZE = 256;
+
+// Colormaps a block of values to texture pixels. Values are first remapped to table indices in a branchless loop,
+// which compilers can vectorize, and then colors are read from the colormap table.
+template <typename T>
+IMPLOT_INLINE void ColormapBlock(const T* values, int count, int stride, double scale_min, double scale_max, const ImU32* table, int table_size, bool qual, ImU32* out) {
+    int idx[HEATMAP_BLOCK_SIZE];
+    const double scale = 1.0 / (scale_max - scale_min);
+    const float  mul   = qual ? (float)table_size : (float)(table_size - 1);
+    const float  add   = qual ? 0.0f : 0.5f;
+    for (int i = 0; i < count; ++i) {
+        const float t = ImClamp((float)(((double)values[i * stride] - scale_min) * scale), 0.0f, 1.0f);
+        idx[i] = ImMin((int)(mul * t + add), table_size - 1);
+    }
+    for (int i = 0; i < count; ++i)
+        out[i] = table[idx[i]];
+}
+
+// Renders heatmap as a single textured quad, if a texture callback is set and the axes are linear (cells must have
+// uniform size in pixels). Returns false if the heatmap needs to be rendered with quads.
+template <typename T>
+bool RenderHeatmapTexture(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, double yref, double ydir, bool col_maj) {
+    ImPlotContext& gp = *GImPlot;
+    if (gp.HeatmapTextureCallback == nullptr)
+        return false;
+    ImPlotPlot& plot = *GetCurrentPlot();
+    if (plot.Axes[plot.CurrentX].TransformForward != nullptr || plot.Axes[plot.CurrentY].TransformForward != nullptr)
+        return false;
+    const ImPlotColormap cmap = gp.Style.Colormap;
+    const ImU32* table = gp.ColormapData.GetTable(cmap);
+    const int table_size = gp.ColormapData.GetTableSize(cmap);
+    const bool qual = gp.ColormapData.IsQual(cmap);
+    // everything that affects pixels goes to the hash
+    const double params[] = { scale_min, scale_max, (double)rows, (double)cols, (double)col_maj };
+    ImU64 hash = HashData64(params, sizeof(params), 0);
+    hash = HashData64(table, table_size * sizeof(ImU32), hash);
+    hash = HashData64(values, (size_t)rows * cols * sizeof(T), hash);
+    const ImGuiID id = GetCurrentItem()->ID;
+    ImTextureID texture = gp.HeatmapTextureCallback(id, hash, nullptr, cols, rows, gp.HeatmapTextureCallbackData);
+    if (texture == nullptr) {
+        gp.HeatmapPixels.resize(rows * cols);
+        ImU32* pixels = gp.HeatmapPixels.Data;
+        for (int r = 0; r < rows; ++r) {
+            // column-major data is transposed, so texture rows always match heatmap rows
+            const T* row_values  = col_maj ? values + r : values + (size_t)r * cols;
+            const int row_stride = col_maj ? rows : 1;
+            for (int c = 0; c < cols; c += HEATMAP_BLOCK_SIZE) {
+                const int count = ImMin(HEATMAP_BLOCK_SIZE, cols - c);
+                ColormapBlock(row_values + (size_t)c * row_stride, count, row_stride, scale_min, scale_max, table, table_size, qual, pixels + (size_t)r * cols + c);
+            }
+        }
+        texture = gp.HeatmapTextureCallback(id, hash, pixels, cols, rows, gp.HeatmapTextureCallbackData);
+        if (texture == nullptr)
+            return false;
+    }
+    Transformer2 transformer;
+    const ImVec2 p_first = transformer(bounds_min.x, yref);
+    const ImVec2 p_last  = transformer(bounds_max.x, yref + ydir * (bounds_max.y - bounds_min.y));
+    draw_list.AddImage(texture, p_first, p_last);
+    return true;
+}
+
 template <typename T>
 void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, double scale_min, double scale_max, const char* fmt, const ImPlotPoint& bounds_min, const ImPlotPoint& bounds_max, bool reverse_y, bool col_maj) {
     ImPlotContext& gp = *GImPlot;
@@ -2427,13 +3609,15 @@ void RenderHeatmap(ImDrawList& draw_list, const T* values, int rows, int cols, d
     }
     const double yref = reverse_y ? bounds_max.y : bounds_min.y;
     const double ydir = reverse_y ? -1 : 1;
-    if (col_maj) {
-        GetterHeatmapColMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
-    }
-    else {
-        GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
-        RenderPrimitives1<RendererRectC>(getter);
+    if (!RenderHeatmapTexture(draw_list, values, rows, cols, scale_min, scale_max, bounds_min, bounds_max, yref, ydir, col_maj)) {
+        if (col_maj) {
+            GetterHeatmapColMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
+            RenderPrimitives1<RendererRectC>(getter);
+        }
+        else {
+            GetterHeatmapRowMaj<T> getter(values, rows, cols, scale_min, scale_max, (bounds_max.x - bounds_min.x) / cols, (bounds_max.y - bounds_min.y) / rows, bounds_min.x, yref, ydir);
+            RenderPrimitives1<RendererRectC>(getter);
+        }
     }
     // labels
     if (fmt != nullptr) {
@@ -2501,6 +3685,197 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotHistogram
 //-----------------------------------------------------------------------------
 
+/// Bins values of a 1D histogram
+template <typename T>
+struct HistogramBinner1 {
+    HistogramBinner1(const T* values, const ImPlotRange& range, double width, int bins) :
+        Values(values),
+        Range(range),
+        Width(width),
+        Bins(bins)
+    { }
+    /// Adds samples [first,last) to counts, and counts samples in and below range
+    IMPLOT_INLINE void operator()(int first, int last, int* counts, int& counted, int& below) const {
+        for (int i = first; i < last; ++i) {
+            const double val = (double)Values[i];
+            if (Range.Contains(val)) {
+                counts[ImClamp((int)((val - Range.Min) / Width), 0, Bins - 1)]++;
+                counted++;
+            }
+            else if (val < Range.Min) {
+                below++;
+            }
+        }
+    }
+    const T* const    Values;
+    const ImPlotRange Range;
+    const double      Width;
+    const int         Bins;
+};
+
+/// Bins points of a 2D histogram (bins are in row-major order)
+template <typename T>
+struct HistogramBinner2 {
+    HistogramBinner2(const T* xs, const T* ys, const ImPlotRect& range, double width, double height, int x_bins, int y_bins) :
+        Xs(xs),
+        Ys(ys),
+        Range(range),
+        Width(width),
+        Height(height),
+        XBins(x_bins),
+        YBins(y_bins)
+    { }
+    /// Adds samples [first,last) to counts, and counts samples in range
+    IMPLOT_INLINE void operator()(int first, int last, int* counts, int& counted, int&) const {
+        for (int i = first; i < last; ++i) {
+            if (Range.Contains((double)Xs[i], (double)Ys[i])) {
+                const int xb = ImClamp( (int)((double)(Xs[i] - Range.X.Min) / Width)  , 0, XBins - 1);
+                const int yb = ImClamp( (int)((double)(Ys[i] - Range.Y.Min) / Height) , 0, YBins - 1);
+                counts[yb * XBins + xb]++;
+                counted++;
+            }
+        }
+    }
+    const T* const   Xs;
+    const T* const   Ys;
+    const ImPlotRect Range;
+    const double     Width;
+    const double     Height;
+    const int        XBins;
+    const int        YBins;
+};
+
+template <typename _Binner>
+struct HistogramChunkTask {
+    const _Binner* Binner;
+    int            First;
+    int            Last;
+    int            Chunks;
+    int            Bins;
+    int*           Counts;   // Chunks x Bins
+    int*           Counted;  // Chunks
+    int*           Below;    // Chunks
+
+    static void Run(int index, void* data) {
+        const HistogramChunkTask& task = *(const HistogramChunkTask*)data;
+        const int samples = task.Last - task.First;
+        const int first   = task.First + (int)((ImS64)samples * index / task.Chunks);
+        const int last    = task.First + (int)((ImS64)samples * (index + 1) / task.Chunks);
+        (*task.Binner)(first, last, task.Counts + (size_t)index * task.Bins, task.Counted[index], task.Below[index]);
+    }
+};
+
+/// Adds samples [first,last) to bin counts. Large numbers of samples are binned in parallel chunks with their own
+/// counts, which are then summed (only if there are enough samples per bin for that to pay off).
+template <typename _Binner>
+void BinHistogram(const _Binner& binner, int first, int last, ImPlotHistogramCache& hist) {
+    ImPlotContext& gp = *GImPlot;
+    const int samples = last - first;
+    const int bins    = hist.Counts.Size;
+    if (bins <= 0)
+        return;
+    const int chunks  = ImMin(ImMin(samples / IMPLOT_HISTOGRAM_CHUNK_MIN_SAMPLES, IMPLOT_HISTOGRAM_MAX_CHUNKS), samples / (4 * bins));
+    if (gp.ParallelForCallback == nullptr || chunks < 2) {
+        binner(first, last, hist.Counts.Data, hist.Counted, hist.Below);
+        return;
+    }
+    int* chunk_counts = GImGui->FrameArena.AllocArray<int>(chunks * bins);
+    memset(chunk_counts, 0, sizeof(int) * (size_t)chunks * bins);
+    int chunk_counted[IMPLOT_HISTOGRAM_MAX_CHUNKS] = {};
+    int chunk_below[IMPLOT_HISTOGRAM_MAX_CHUNKS]   = {};
+    HistogramChunkTask<_Binner> task = { &binner, first, last, chunks, bins, chunk_counts, chunk_counted, chunk_below };
+    gp.ParallelForCallback(chunks, &HistogramChunkTask<_Binner>::Run, &task, gp.ParallelForCallbackData);
+    for (int c = 0; c < chunks; ++c) {
+        const int* counts = chunk_counts + (size_t)c * bins;
+        for (int b = 0; b < bins; ++b)
+            hist.Counts[b] += counts[b];
+        hist.Counted += chunk_counted[c];
+        hist.Below   += chunk_below[c];
+    }
+}
+
+/// Gets bin counts of the histogram with the given label in the current plot. Counts of histograms without
+/// ImPlotHistogramFlags_Cached are always recomputed.
+IMPLOT_INLINE ImPlotHistogramCache& GetHistogramCache(const char* label_id, ImPlotHistogramFlags flags) {
+    ImPlotContext& gp = *GImPlot;
+    if (!ImHasFlag(flags, ImPlotHistogramFlags_Cached)) {
+        gp.TempHistogram.Count = -1;
+        return gp.TempHistogram;
+    }
+    IM_ASSERT_USER_ERROR(gp.CurrentPlot != nullptr, "PlotHistogram() needs to be called between BeginPlot() and EndPlot()!");
+    const int frame = ImGui::GetFrameCount();
+    if (gp.HistogramSweepFrame != frame) {
+        gp.HistogramSweepFrame = frame;
+        for (int n = 0; n < gp.Histograms.GetMapSize(); ++n) {
+            ImPlotHistogramCache* stale = gp.Histograms.TryGetMapData(n);
+            if (stale && frame - stale->LastFrame > IMPLOT_HISTOGRAM_RELEASE_FRAMES)
+                gp.Histograms.Remove(gp.Histograms.Map.Data[n].key, stale);
+        }
+    }
+    ImPlotHistogramCache& hist = *gp.Histograms.GetOrAddByKey(gp.CurrentItems->GetItemID(label_id));
+    hist.LastFrame = frame;
+    return hist;
+}
+
+/// Returns true if bins of a histogram don't depend on data appended to it, i.e. if data and requested bins are the
+/// same as when counts were computed and the number of bins is not computed from the number of samples
+IMPLOT_INLINE bool CanAppendToHistogram(const ImPlotHistogramCache& hist, const void* xs, const void* ys, int count, int x_bins, int y_bins, const ImPlotRect& range) {
+    return hist.Count >= 0 && count >= hist.Count && hist.Data[0] == xs && hist.Data[1] == ys
+        && hist.BinsSpec[0] == x_bins && hist.BinsSpec[1] == y_bins && x_bins > 0 && y_bins > 0
+        && hist.RangeSpec.X.Min == range.X.Min && hist.RangeSpec.X.Max == range.X.Max
+        && hist.RangeSpec.Y.Min == range.Y.Min && hist.RangeSpec.Y.Max == range.Y.Max;
+}
+
+/// Returns true if a range taken from data (if requested range is zero) doesn't change with appended values
+template <typename T>
+IMPLOT_INLINE bool IsHistogramRangeKept(const T* values, int first, int last, const ImPlotRange& spec, const ImPlotRange& range) {
+    if (spec.Min != 0 || spec.Max != 0 || first == last)
+        return true;
+    T Min, Max;
+    ImMinMaxArray(values + first, last - first, &Min, &Max);
+    return (double)Min >= range.Min && (double)Max <= range.Max;
+}
+
+/// Updates bin counts of a histogram of values, only binning appended values if possible
+template <typename T>
+void UpdateHistogram(ImPlotHistogramCache& hist, const T* values, int count, int bins, ImPlotRange range) {
+    const ImPlotRect spec(range.Min, range.Max, 0, 0);
+    const int bins_spec = bins;
+    int first = 0;
+    if (CanAppendToHistogram(hist, values, nullptr, count, bins, 1, spec)) {
+        if (count == hist.Count)
+            return;
+        if (IsHistogramRangeKept(values, hist.Count, count, range, hist.Range.X))
+            first = hist.Count;
+    }
+    if (first == 0) {
+        if (range.Min == 0 && range.Max == 0) {
+            T Min, Max;
+            ImMinMaxArray(values, count, &Min, &Max);
+            range.Min = (double)Min;
+            range.Max = (double)Max;
+        }
+        double width;
+        if (bins < 0)
+            CalculateBins(values, count, bins, range, bins, width);
+        else
+            width = range.Size() / bins;
+        hist.Range.X  = range;
+        hist.Bins[0]  = bins;
+        hist.Width[0] = width;
+        hist.Counts.resize(bins);
+        memset(hist.Counts.Data, 0, hist.Counts.size_in_bytes());
+        hist.Counted = hist.Below = 0;
+    }
+    BinHistogram(HistogramBinner1<T>(values, hist.Range.X, hist.Width[0], hist.Bins[0]), first, count, hist);
+    hist.Data[0]     = values;
+    hist.Data[1]     = nullptr;
+    hist.BinsSpec[0] = bins_spec;
+    hist.BinsSpec[1] = 1;
+    hist.RangeSpec   = spec;
+    hist.Count       = count;
+}
+
 template <typename T>
 double PlotHistogram(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags) {
 
@@ -2511,44 +3886,23 @@ double PlotHistogram(const char* label_id, const T* values, int count, int bins,
     if (count <= 0 || bins == 0)
         return 0;
 
-    if (range.Min == 0 && range.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(values, count, &Min, &Max);
-        range.Min = (double)Min;
-        range.Max = (double)Max;
-    }
-
-    double width;
-    if (bins < 0)
-        CalculateBins(values, count, bins, range, bins, width);
-    else
-        width = range.Size() / bins;
+    ImPlotHistogramCache& hist = GetHistogramCache(label_id, flags);
+    UpdateHistogram(hist, values, count, bins, range);
+    bins = hist.Bins[0];
+    range = hist.Range.X;
+    const double width = hist.Width[0];
 
-    ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_centers = gp.TempDouble1;
-    ImVector<double>& bin_counts  = gp.TempDouble2;
-    bin_centers.resize(bins);
-    bin_counts.resize(bins);
-    int below = 0;
+    double* bin_centers = GImGui->FrameArena.AllocArray<double>(bins);
+    double* bin_counts  = GImGui->FrameArena.AllocArray<double>(bins);
+    const int below = hist.Below;
+    const int counted = hist.Counted;
 
+    double max_count = 0;
     for (int b = 0; b < bins; ++b) {
         bin_centers[b] = range.Min + b * width + width * 0.5;
-        bin_counts[b] = 0;
-    }
-    int counted = 0;
-    double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        double val = (double)values[i];
-        if (range.Contains(val)) {
-            const int b = ImClamp((int)((val - range.Min) / width), 0, bins - 1);
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
-        }
-        else if (val < range.Min) {
-            below++;
-        }
+        bin_counts[b] = hist.Counts[b];
+        if (bin_counts[b] > max_count)
+            max_count = bin_counts[b];
     }
     if (cumulative && density) {
         if (outliers)
@@ -2574,9 +3928,9 @@ double PlotHistogram(const char* label_id, const T* values, int count, int bins,
         max_count *= scale;
     }
     if (ImHasFlag(flags, ImPlotHistogramFlags_Horizontal))
-        PlotBars(label_id, &bin_counts.Data[0], &bin_centers.Data[0], bins, bar_scale*width, ImPlotBarsFlags_Horizontal);
+        PlotBars(label_id, bin_counts, bin_centers, bins, bar_scale*width, ImPlotBarsFlags_Horizontal);
     else
-        PlotBars(label_id, &bin_centers.Data[0], &bin_counts.Data[0], bins, bar_scale*width);
+        PlotBars(label_id, bin_centers, bin_counts, bins, bar_scale*width);
     return max_count;
 }
 #define INSTANTIATE_MACRO(T) template IMPLOT_API double PlotHistogram<T>(const char* label_id, const T* values, int count, int bins, double bar_scale, ImPlotRange range, ImPlotHistogramFlags flags);
@@ -2587,6 +3941,59 @@ CALL_INSTANTIATE_FOR_NUMERIC_TYPES()
 // [SECTION] PlotHistogram2D
 //-----------------------------------------------------------------------------
 
+/// Updates bin counts of a histogram of points, only binning appended points if possible
+template <typename T>
+void UpdateHistogram2D(ImPlotHistogramCache& hist, const T* xs, const T* ys, int count, int x_bins, int y_bins, ImPlotRect range) {
+    const ImPlotRect spec = range;
+    const int x_bins_spec = x_bins;
+    const int y_bins_spec = y_bins;
+    int first = 0;
+    if (CanAppendToHistogram(hist, xs, ys, count, x_bins, y_bins, range)) {
+        if (count == hist.Count)
+            return;
+        if (IsHistogramRangeKept(xs, hist.Count, count, range.X, hist.Range.X) && IsHistogramRangeKept(ys, hist.Count, count, range.Y, hist.Range.Y))
+            first = hist.Count;
+    }
+    if (first == 0) {
+        if (range.X.Min == 0 && range.X.Max == 0) {
+            T Min, Max;
+            ImMinMaxArray(xs, count, &Min, &Max);
+            range.X.Min = (double)Min;
+            range.X.Max = (double)Max;
+        }
+        if (range.Y.Min == 0 && range.Y.Max == 0) {
+            T Min, Max;
+            ImMinMaxArray(ys, count, &Min, &Max);
+            range.Y.Min = (double)Min;
+            range.Y.Max = (double)Max;
+        }
+        double width, height;
+        if (x_bins < 0)
+            CalculateBins(xs, count, x_bins, range.X, x_bins, width);
+        else
+            width = range.X.Size() / x_bins;
+        if (y_bins < 0)
+            CalculateBins(ys, count, y_bins, range.Y, y_bins, height);
+        else
+            height = range.Y.Size() / y_bins;
+        hist.Range    = range;
+        hist.Bins[0]  = x_bins;
+        hist.Bins[1]  = y_bins;
+        hist.Width[0] = width;
+        hist.Width[1] = height;
+        hist.Counts.resize(x_bins * y_bins);
+        memset(hist.Counts.Data, 0, hist.Counts.size_in_bytes());
+        hist.Counted = hist.Below = 0;
+    }
+    BinHistogram(HistogramBinner2<T>(xs, ys, hist.Range, hist.Width[0], hist.Width[1], hist.Bins[0], hist.Bins[1]), first, count, hist);
+    hist.Data[0]     = xs;
+    hist.Data[1]     = ys;
+    hist.BinsSpec[0] = x_bins_spec;
+    hist.BinsSpec[1] = y_bins_spec;
+    hist.RangeSpec   = spec;
+    hist.Count       = count;
+}
+
 template <typename T>
 double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count, int x_bins, int y_bins, ImPlotRect range, ImPlotHistogramFlags flags) {
 
@@ -2598,50 +4005,24 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
     if (count <= 0 || x_bins == 0 || y_bins == 0)
         return 0;
 
-    if (range.X.Min == 0 && range.X.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(xs, count, &Min, &Max);
-        range.X.Min = (double)Min;
-        range.X.Max = (double)Max;
-    }
-    if (range.Y.Min == 0 && range.Y.Max == 0) {
-        T Min, Max;
-        ImMinMaxArray(ys, count, &Min, &Max);
-        range.Y.Min = (double)Min;
-        range.Y.Max = (double)Max;
-    }
-
-    double width, height;
-    if (x_bins < 0)
-        CalculateBins(xs, count, x_bins, range.X, x_bins, width);
-    else
-        width = range.X.Size() / x_bins;
-    if (y_bins < 0)
-        CalculateBins(ys, count, y_bins, range.Y, y_bins, height);
-    else
-        height = range.Y.Size() / y_bins;
+    ImPlotHistogramCache& hist = GetHistogramCache(label_id, flags);
+    UpdateHistogram2D(hist, xs, ys, count, x_bins, y_bins, range);
+    x_bins = hist.Bins[0];
+    y_bins = hist.Bins[1];
+    range = hist.Range;
+    const double width  = hist.Width[0];
+    const double height = hist.Width[1];
 
     const int bins = x_bins * y_bins;
 
-    ImPlotContext& gp = *GImPlot;
-    ImVector<double>& bin_counts = gp.TempDouble1;
-    bin_counts.resize(bins);
-
-    for (int b = 0; b < bins; ++b)
-        bin_counts[b] = 0;
+    double* bin_counts = GImGui->FrameArena.AllocArray<double>(bins);
 
-    int counted = 0;
+    const int counted = hist.Counted;
     double max_count = 0;
-    for (int i = 0; i < count; ++i) {
-        if (range.Contains((double)xs[i], (double)ys[i])) {
-            const int xb = ImClamp( (int)((double)(xs[i] - range.X.Min) / width)  , 0, x_bins - 1);
-            const int yb = ImClamp( (int)((double)(ys[i] - range.Y.Min) / height) , 0, y_bins - 1);
-            const int b  = yb * x_bins + xb;
-            bin_counts[b] += 1.0;
-            if (bin_counts[b] > max_count)
-                max_count = bin_counts[b];
-            counted++;
-        }
+    for (int b = 0; b < bins; ++b) {
+        bin_counts[b] = hist.Counts[b];
+        if (bin_counts[b] > max_count)
+            max_count = bin_counts[b];
     }
     if (density) {
         double scale = 1.0 / ((outliers ? count : counted) * width * height);
@@ -2656,7 +4037,7 @@ double PlotHistogram2D(const char* label_id, const T* xs, const T* ys, int count
             return max_count;
         }
         ImDrawList& draw_list = *GetPlotDrawList();
-        RenderHeatmap(draw_list, &bin_counts.Data[0], y_bins, x_bins, 0, max_count, nullptr, range.Min(), range.Max(), false, col_maj);
+        RenderHeatmap(draw_list, bin_counts, y_bins, x_bins, 0, max_count, nullptr, range.Min(), range.Max(), false, col_maj);
         EndItem();
     }
     return max_count;
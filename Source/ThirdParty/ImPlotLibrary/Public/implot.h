@@ -223,22 +223,28 @@ enum ImPlotItemFlags_ {
     ImPlotItemFlags_None     = 0,
     ImPlotItemFlags_NoLegend = 1 << 0, // the item won't have a legend entry displayed
     ImPlotItemFlags_NoFit    = 1 << 1, // the item won't be considered for plot fits
+    ImPlotItemFlags_CacheFit = 1 << 2, // the item's data only changes by appending samples, so its fit extents are cached and only extended with new samples (see SetNextItemAppended)
+    ImPlotItemFlags_Pickable = 1 << 3, // the item's points are kept in a spatial index, which is rebuilt when its data changes (see GetNearestItemPoint and GetItemPointsInRect)
 };
 
 // Flags for PlotLine
 enum ImPlotLineFlags_ {
-    ImPlotLineFlags_None        = 0,       // default
-    ImPlotLineFlags_Segments    = 1 << 10, // a line segment will be rendered from every two consecutive points
-    ImPlotLineFlags_Loop        = 1 << 11, // the last and first point will be connected to form a closed loop
-    ImPlotLineFlags_SkipNaN     = 1 << 12, // NaNs values will be skipped instead of rendered as missing data
-    ImPlotLineFlags_NoClip      = 1 << 13, // markers (if displayed) on the edge of a plot will not be clipped
-    ImPlotLineFlags_Shaded      = 1 << 14, // a filled region between the line and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotLineFlags_None             = 0,       // default
+    ImPlotLineFlags_Segments         = 1 << 10, // a line segment will be rendered from every two consecutive points
+    ImPlotLineFlags_Loop             = 1 << 11, // the last and first point will be connected to form a closed loop
+    ImPlotLineFlags_SkipNaN          = 1 << 12, // NaNs values will be skipped instead of rendered as missing data
+    ImPlotLineFlags_NoClip           = 1 << 13, // markers (if displayed) on the edge of a plot will not be clipped
+    ImPlotLineFlags_Shaded           = 1 << 14, // a filled region between the line and horizontal origin will be rendered; use PlotShaded for more advanced cases
+    ImPlotLineFlags_Decimate         = 1 << 15, // only the first, last, min and max samples of each pixel column will be rendered (exact envelope); samples outside of the x range are skipped, which requires increasing x values
+    ImPlotLineFlags_DecimateLTTB     = 1 << 16, // samples will be reduced to two per pixel column with Largest-Triangle-Three-Buckets (preserves shape, not exact); same x value requirement as ImPlotLineFlags_Decimate
+    ImPlotLineFlags_DecimateRetained = 1 << 17, // same as ImPlotLineFlags_Decimate, but min/max of large series (64k+ samples) are retained between frames; samples may only be appended to the end of data (changing them in place requires a new label or data pointer)
 };
 
 // Flags for PlotScatter
 enum ImPlotScatterFlags_ {
-    ImPlotScatterFlags_None   = 0,       // default
-    ImPlotScatterFlags_NoClip = 1 << 10, // markers on the edge of a plot will not be clipped
+    ImPlotScatterFlags_None     = 0,       // default
+    ImPlotScatterFlags_NoClip   = 1 << 10, // markers on the edge of a plot will not be clipped
+    ImPlotScatterFlags_Decimate = 1 << 11, // only one marker will be rendered for each pixel; markers outside of the plot are skipped
 };
 
 // Flags for PlotStairs
@@ -304,7 +310,8 @@ enum ImPlotHistogramFlags_ {
     ImPlotHistogramFlags_Cumulative = 1 << 11, // each bin will contain its count plus the counts of all previous bins (not supported by PlotHistogram2D)
     ImPlotHistogramFlags_Density    = 1 << 12, // counts will be normalized, i.e. the PDF will be visualized, or the CDF will be visualized if Cumulative is also set
     ImPlotHistogramFlags_NoOutliers = 1 << 13, // exclude values outside the specifed histogram range from the count toward normalizing and cumulative counts
-    ImPlotHistogramFlags_ColMajor   = 1 << 14  // data will be read in column major order (not supported by PlotHistogram)
+    ImPlotHistogramFlags_ColMajor   = 1 << 14, // data will be read in column major order (not supported by PlotHistogram)
+    ImPlotHistogramFlags_Cached     = 1 << 15  // data only changes by appending values, so bin counts are kept between frames and only appended values are binned (as long as bins don't change)
 };
 
 // Flags for PlotDigital (placeholder)
@@ -590,6 +597,16 @@ typedef ImPlotPoint (*ImPlotGetter)(int idx, void* user_data);
 // Callback signature for axis transform.
 typedef double (*ImPlotTransform)(double value, void* user_data);
 
+// Callback signature for heatmap textures (see SetHeatmapTextureCallback). Called first with null pixels, in which case
+// it should return the texture created for #id if it was created with the same #hash, or null otherwise. When null is
+// returned, it is called again with #width x #height colors (rows from top to bottom) and should return a texture with
+// those pixels, or null if textures cannot be created.
+typedef ImTextureID (*ImPlotHeatmapTextureCallback)(ImGuiID id, ImU64 hash, const ImU32* pixels, int width, int height, void* user_data);
+
+// Callback signature for parallel rendering (see SetParallelForCallback). Should call #func(i, #func_data) for each i in
+// [0, #count), possibly concurrently, and return once all calls have completed.
+typedef void (*ImPlotParallelForCallback)(int count, void (*func)(int index, void* func_data), void* func_data, void* user_data);
+
 namespace ImPlot {
 
 //-----------------------------------------------------------------------------
@@ -856,11 +873,15 @@ IMPLOT_API void SetNextAxesToFit();
 IMPLOT_TMP void PlotLine(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotLineFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotLine(const char* label_id, const T* xs, const T* ys, int count, ImPlotLineFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotLineG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotLineFlags flags=0);
+// Plots a line from ring buffers of #capacity elements, holding #count samples that start at index #head and wrap around the end of buffers. Data is read in place.
+IMPLOT_TMP void PlotLineRing(const char* label_id, const T* xs, const T* ys, int count, int capacity, int head, ImPlotLineFlags flags=0, int stride=sizeof(T));
 
 // Plots a standard 2D scatter plot. Default marker is ImPlotMarker_Circle.
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotScatterFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_TMP void PlotScatter(const char* label_id, const T* xs, const T* ys, int count, ImPlotScatterFlags flags=0, int offset=0, int stride=sizeof(T));
 IMPLOT_API void PlotScatterG(const char* label_id, ImPlotGetter getter, void* data, int count, ImPlotScatterFlags flags=0);
+// Plots a scatter plot from ring buffers of #capacity elements, holding #count samples that start at index #head and wrap around the end of buffers. Data is read in place.
+IMPLOT_TMP void PlotScatterRing(const char* label_id, const T* xs, const T* ys, int count, int capacity, int head, ImPlotScatterFlags flags=0, int stride=sizeof(T));
 
 // Plots a a stairstep graph. The y value is continued constantly to the right from every x position, i.e. the interval [x[i], x[i+1]) has the value y[i]
 IMPLOT_TMP void PlotStairs(const char* label_id, const T* values, int count, double xscale=1, double xstart=0, ImPlotStairsFlags flags=0, int offset=0, int stride=sizeof(T));
@@ -994,6 +1015,18 @@ IMPLOT_API ImPlotRect GetPlotSelection(ImAxis x_axis = IMPLOT_AUTO, ImAxis y_axi
 // Cancels a the current plot box selection.
 IMPLOT_API void CancelPlotSelection();
 
+// Returns the index of the sample of an item plotted with ImPlotItemFlags_Pickable, which is nearest to the mouse
+// cursor and at most #radius pixels from it, or -1 if there is no such sample. Optionally outputs its coordinates.
+// Only items with one point per sample (e.g. lines and scatters) can be picked. Data of items is indexed while they are
+// plotted, and reindexed when their data pointers, offsets or counts change (or SetNextItemAppended is used), so
+// changing values in place requires changing the item's count for a frame or using a new label. Must be called after
+// the item is plotted in the current frame, otherwise -1 is returned.
+IMPLOT_API int GetNearestItemPoint(const char* label_id, float radius = 8, ImPlotPoint* point = nullptr);
+// Appends indices of samples of an item plotted with ImPlotItemFlags_Pickable, which are inside #rect (e.g. from
+// GetPlotSelection or DragRect), to #indices and returns their number. Indices are not sorted. Like GetNearestItemPoint,
+// must be called after the item is plotted in the current frame, otherwise nothing is found.
+IMPLOT_API int GetItemPointsInRect(const char* label_id, const ImPlotRect& rect, ImVector<int>* indices);
+
 // Hides or shows the next plot item (i.e. as if it were toggled from the legend).
 // Use ImPlotCond_Always if you need to forcefully set this every frame.
 IMPLOT_API void HideNextItem(bool hidden = true, ImPlotCond cond = ImPlotCond_Once);
@@ -1122,6 +1155,11 @@ IMPLOT_API void SetNextFillStyle(const ImVec4& col = IMPLOT_AUTO_COL, float alph
 IMPLOT_API void SetNextMarkerStyle(ImPlotMarker marker = IMPLOT_AUTO, float size = IMPLOT_AUTO, const ImVec4& fill = IMPLOT_AUTO_COL, float weight = IMPLOT_AUTO, const ImVec4& outline = IMPLOT_AUTO_COL);
 // Set the error bar style for the next item only.
 IMPLOT_API void SetNextErrorBarStyle(const ImVec4& col = IMPLOT_AUTO_COL, float size = IMPLOT_AUTO, float weight = IMPLOT_AUTO);
+// Report that #count samples were appended to the data of the next item since the previous frame, if that item uses
+// ImPlotItemFlags_CacheFit. Only needed when it can't be deduced from the data (e.g. for ring buffers with an offset,
+// where appending doesn't change the count). Cached extents are extended with the last #count samples, so they may
+// still include samples that were overwritten.
+IMPLOT_API void SetNextItemAppended(int count);
 
 // Gets the last item primary color (i.e. its legend icon color)
 IMPLOT_API ImVec4 GetLastItemColor();
@@ -1225,6 +1263,17 @@ IMPLOT_API void PushPlotClipRect(float expand=0);
 // Pop plot clip rect. Call between Begin/EndPlot.
 IMPLOT_API void PopPlotClipRect();
 
+// Set callback used to render heatmaps (and 2D histograms) on linear axes as one textured quad instead of one quad per
+// cell. Textures are only requested to be updated when data, scale or colormap change. Pass null to disable.
+IMPLOT_API void SetHeatmapTextureCallback(ImPlotHeatmapTextureCallback callback, void* user_data = nullptr);
+
+// Set callback used to generate vertices of large items in parallel. Primitives are split into chunks that are rendered
+// into separate buffers and spliced in order, so output is identical to serial rendering. Only items with data read
+// from arrays and plotted on axes without custom scale transforms are rendered in parallel (never those using
+// ImPlotGetter or SetupAxisScale with callbacks), so user callbacks are only called from the calling thread. Pass null to
+// disable.
+IMPLOT_API void SetParallelForCallback(ImPlotParallelForCallback callback, void* user_data = nullptr);
+
 // Shows ImPlot style selector dropdown menu.
 IMPLOT_API bool ShowStyleSelector(const char* label);
 // Shows ImPlot colormap selector dropdown menu.